@@ -190,4 +190,66 @@ macro(CL_BUILD_COMPILER_PLUGIN PLUGIN ANALYZER LIBCL_PATH)
         target_link_libraries(${PLUGIN} ${CLGCC_LIB})
     endif()
     target_link_libraries(${PLUGIN} ${CL_LIB} ${ANALYZER})
+
+    # listeners appended by cl_chain_append_async() run in their own threads
+    target_link_libraries(${PLUGIN} pthread)
+endmacro()
+
+# build stand-alone driver DRIVER for bitcode files from static lib ANALYZER
+# using CL from LIBCL_PATH, CL_BUILD_COMPILER_PLUGIN needs to be called first
+macro(CL_BUILD_LLVM_DRIVER DRIVER PLUGIN ANALYZER LIBCL_PATH)
+    if(ENABLE_LLVM)
+        add_executable(${DRIVER} "${PROJECT_BINARY_DIR}/${PLUGIN}_name.cc")
+
+        if("${LIBCL_PATH}" STREQUAL "")
+            set(CLLLVMDRV_LIB clllvmdrv)
+        else()
+            find_library(CLLLVMDRV_LIB clllvmdrv
+                PATHS ${LIBCL_PATH} NO_DEFAULT_PATH)
+        endif()
+
+        # query the libraries of the host LLVM, opt(1) provides them otherwise
+        get_filename_component(LLVM_BIN_DIR "${OPT_HOST}" PATH)
+        execute_process(COMMAND "${LLVM_BIN_DIR}/llvm-config" "--ldflags"
+            "--libs" "bitreader" "irreader" "scalaropts" "transformutils"
+            RESULT_VARIABLE LLVM_CONFIG_STATUS
+            OUTPUT_VARIABLE LLVM_LINK_FLAGS OUTPUT_STRIP_TRAILING_WHITESPACE)
+        if (NOT "${LLVM_CONFIG_STATUS}" EQUAL 0)
+            message(FATAL_ERROR "failed to query llvm-config for ${DRIVER}")
+        endif()
+        string(REPLACE "\n" " " LLVM_LINK_FLAGS "${LLVM_LINK_FLAGS}")
+        separate_arguments(LLVM_LINK_FLAGS)
+
+        # the analyzer and CL refer to each other, resolve them as a group
+        target_link_libraries(${DRIVER} ${CLLLVMDRV_LIB} ${CLLLVM_LIB}
+            -Wl,--start-group ${CL_LIB} ${ANALYZER} -Wl,--end-group
+            ${LLVM_LINK_FLAGS} pthread)
+    endif()
+endmacro()
+
+# 'make perf-bench' runs the given test-cases by build-aux/perf-bench.sh and
+# compares the results with BASELINE, 'make perf-bench-baseline' overwrites it
+macro(CL_ADD_PERF_BENCH PLUGIN BASELINE ARGS CFLAGS)
+    set(PERF_BENCH_REPEAT 3 CACHE STRING
+        "Count of runs of each test-case in 'make perf-bench'")
+    set(PERF_BENCH_TOLERANCE 20 CACHE STRING
+        "Tolerated slow-down (in percent) against the perf-bench baseline")
+
+    get_property(PERF_BENCH_PLUG TARGET ${PLUGIN} PROPERTY LOCATION)
+    set(PERF_BENCH_CMD env "GCC_HOST=${GCC_HOST}"
+        "${PROJECT_SOURCE_DIR}/../build-aux/perf-bench.sh"
+        -r "${PERF_BENCH_REPEAT}" -t "${PERF_BENCH_TOLERANCE}"
+        -c "${CFLAGS}" -b "${BASELINE}"
+        -o "${PROJECT_BINARY_DIR}/perf-bench.csv")
+    if(NOT "${ARGS}" STREQUAL "")
+        set(PERF_BENCH_CMD ${PERF_BENCH_CMD} -a "${ARGS}")
+    endif()
+
+    add_custom_target(perf-bench
+        COMMAND ${PERF_BENCH_CMD} "${PERF_BENCH_PLUG}" ${ARGN}
+        DEPENDS ${PLUGIN} VERBATIM)
+
+    add_custom_target(perf-bench-baseline
+        COMMAND ${PERF_BENCH_CMD} -u "${PERF_BENCH_PLUG}" ${ARGN}
+        DEPENDS ${PLUGIN} VERBATIM)
 endmacro()
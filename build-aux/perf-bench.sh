@@ -0,0 +1,200 @@
+#!/bin/bash
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is part of predator.
+#
+# predator is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# any later version.
+#
+# predator is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with predator.  If not, see <http://www.gnu.org/licenses/>.
+
+# run a curated set of test-cases through a GCC plug-in several times, collect
+# wall time, peak RSS and the analyzer's own counters (see cl/perfstats.cc) and
+# compare the results with a stored baseline
+
+export SELF="$0"
+export LC_ALL=C
+export CCACHE_DISABLE=1
+
+die() {
+    printf "%s: %s\n" "$SELF" "$*" >&2
+    exit 1
+}
+
+usage() {
+    printf "Usage: %s [OPTIONS] PLUGIN FILE...\n\n" "$SELF" >&2
+    cat >&2 << EOF
+    -a ARGS     args given to the analyzer (-fplugin-arg-NAME-args)
+    -b FILE     baseline to compare with (CSV written by -o)
+    -c CFLAGS   additional flags given to gcc
+    -m SEC      ignore time differences below SEC seconds (default: 0.1)
+    -o FILE     write the results to FILE (default: perf-bench.csv)
+    -r N        run each test-case N times, the median is taken (default: 3)
+    -t PERCENT  tolerated slow-down/growth against the baseline (default: 20)
+    -u          overwrite the baseline by the results
+
+    The gcc to use is taken from \$GCC_HOST (default: gcc).
+EOF
+    exit 1
+}
+
+# default setup
+args=
+baseline=
+cflags=
+min_sec=0.1
+output=perf-bench.csv
+repeat=3
+tolerance=20
+update=no
+
+while getopts "a:b:c:m:o:r:t:u" opt; do
+    case "$opt" in
+        a) args="$OPTARG" ;;
+        b) baseline="$OPTARG" ;;
+        c) cflags="$OPTARG" ;;
+        m) min_sec="$OPTARG" ;;
+        o) output="$OPTARG" ;;
+        r) repeat="$OPTARG" ;;
+        t) tolerance="$OPTARG" ;;
+        u) update=yes ;;
+        *) usage ;;
+    esac
+done
+shift $((OPTIND - 1))
+
+test 2 -le "$#" || usage
+plugin="$1"
+shift
+
+test -r "$plugin" || die "plug-in not found: $plugin"
+name="$(basename "$plugin" .so)"
+
+GCC_HOST="${GCC_HOST-gcc}"
+"$GCC_HOST" --version >/dev/null 2>&1 || die "unable to run gcc: $GCC_HOST"
+
+# GNU time is needed to measure the peak RSS of cc1
+TIME="${TIME_BIN-/usr/bin/time}"
+"$TIME" -f "%e %M" true >/dev/null 2>&1 || die "GNU time not found: $TIME"
+
+tmp="$(mktemp -d /tmp/perf-bench.XXXXXX)" || die "mktemp failed"
+trap "rm -rf '$tmp'" EXIT
+
+# pick the value of the given field from the stats written by the plug-in
+stat_value() {
+    awk -F, -v kind="$1" -v name="$2" -v field="$3" \
+        '$1 == kind && $2 == name && $3 == field { print $4; found = 1 }
+        END { if (!found) print 0 }' "$tmp/stats.csv"
+}
+
+# run a test-case once, print "WALL RSS_KB BLOCKS STATES JOINS HPB_AVG HPB_MAX"
+run_once() {
+    local plug_args=
+    test -n "$args" && plug_args="-fplugin-arg-$name-args=$args"
+
+    rm -f "$tmp/stats.csv"
+    "$TIME" -f "%e %M" -o "$tmp/time" \
+        "$GCC_HOST" -S -o /dev/null $cflags "$1" \
+        -fplugin="$plugin" $plug_args \
+        -fplugin-arg-$name-preserve-ec \
+        -fplugin-arg-$name-perf-stats="$tmp/stats.csv" \
+        >/dev/null 2>&1
+
+    test -r "$tmp/stats.csv" || return 1
+
+    # Predator counts basic blocks, Forester counts symbolic states
+    local blocks="$(stat_value counter sl.blocks_executed value)"
+    local states="$(stat_value counter fa.states_executed value)"
+
+    local joins="$(stat_value timer sl.join calls)"
+    local hpb_cnt="$(stat_value histogram sl.heaps_per_block count)"
+    local hpb_sum="$(stat_value histogram sl.heaps_per_block sum)"
+    local hpb_max="$(stat_value histogram sl.heaps_per_block max)"
+    local hpb_avg="$(awk -v s="$hpb_sum" -v c="$hpb_cnt" \
+        'BEGIN { printf "%.2f", (c ? s / c : 0) }')"
+
+    printf "%s %s %s %s %s %s\n" "$(tail -1 "$tmp/time")" \
+        "$blocks" "$states" "$joins" "$hpb_avg" "$hpb_max"
+}
+
+printf "file,wall,rss_kb,blocks,states,joins,%s\n" \
+    "heaps_per_block_avg,heaps_per_block_max" > "$tmp/results.csv"
+
+failed=0
+for file in "$@"; do
+    key="$(basename "$file")"
+    printf "%-48s" "$key" >&2
+
+    if test ! -r "$file"; then
+        # e.g. a test-case of a suite that has not been imported
+        printf " MISSING, skipped\n" >&2
+        continue
+    fi
+
+    rm -f "$tmp/runs"
+    for i in $(seq "$repeat"); do
+        if ! run_once "$file" >> "$tmp/runs"; then
+            printf " FAILED\n" >&2
+            failed=1
+            continue 2
+        fi
+    done
+
+    # median of wall times, maximum of RSS, counters of the last run
+    wall="$(sort -n -k1,1 "$tmp/runs" | awk -v n="$repeat" \
+        'NR == int((n + 1) / 2) { print $1 }')"
+    line="$(awk -v wall="$wall" \
+        '{ if (rss < $2) rss = $2; rest = $3 "," $4 "," $5 "," $6 "," $7 }
+        END { printf "%s,%s,%s", wall, rss, rest }' "$tmp/runs")"
+
+    printf "%s,%s\n" "$key" "$line" >> "$tmp/results.csv"
+    printf " %s\n" "$line" >&2
+done
+
+cp "$tmp/results.csv" "$output" || die "failed to write $output"
+
+if test -z "$baseline"; then
+    exit $failed
+fi
+
+if test xyes = "x$update"; then
+    cp "$output" "$baseline" || die "failed to write $baseline"
+    printf "%s: baseline updated: %s\n" "$SELF" "$baseline" >&2
+    exit $failed
+fi
+
+if test ! -r "$baseline"; then
+    printf "%s: baseline not found, nothing to compare with: %s\n" \
+        "$SELF" "$baseline" >&2
+    exit $failed
+fi
+
+# compare with the baseline, report each metric that exceeds the tolerance
+awk -F, -v tol="$tolerance" -v min_sec="$min_sec" '
+    FNR == 1 { next }
+    NR == FNR { for (i = 2; i <= NF; ++i) base[$1, i] = $i; seen[$1] = 1; next }
+    !($1 in seen) { printf "%-48s new test-case, no baseline\n", $1; next }
+    {
+        split("wall,rss_kb,blocks,states,joins,heaps_per_block_avg", names, ",")
+        for (i = 2; i <= 7; ++i) {
+            old = base[$1, i]; new = $i
+            if (i == 2 && new - old < min_sec)
+                continue
+            if (new <= old * (1 + tol / 100.0))
+                continue
+            printf "%-48s %s regressed: %s -> %s\n", $1, names[i - 1], old, new
+            rv = 1
+        }
+    }
+    END { exit rv }' "$baseline" "$output" >&2 || failed=1
+
+exit $failed
@@ -0,0 +1,450 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of predator.
+ *
+ * predator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * predator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with predator.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config_cl.h"
+#include "cl_async.hh"
+
+#include <cl/code_listener.h>
+#include <cl/cl_msg.hh>
+
+#include "cl.hh"
+#include "cl_storage.hh"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <boost/foreach.hpp>
+
+using CodeStorage::dupString;
+using CodeStorage::freeString;
+using CodeStorage::releaseOperand;
+using CodeStorage::storeOperand;
+
+namespace {
+
+/// count of slots in the queue, needs to be a power of two
+const size_t queueSize = 0x1000;
+static_assert(!(queueSize & (queueSize - 1)), "queueSize is not 2^n");
+
+/// count of unsuccessful polls before the consumer starts to sleep
+const int spinLimit = 0x40;
+
+enum EEventCode {
+    EV_FILE_OPEN,
+    EV_FILE_CLOSE,
+    EV_FNC_OPEN,
+    EV_FNC_ARG_DECL,
+    EV_FNC_CLOSE,
+    EV_BB_OPEN,
+    EV_INSN,
+    EV_INSN_CALL_OPEN,
+    EV_INSN_CALL_ARG,
+    EV_INSN_CALL_CLOSE,
+    EV_INSN_SWITCH_OPEN,
+    EV_INSN_SWITCH_CASE,
+    EV_INSN_SWITCH_CLOSE,
+    EV_ACKNOWLEDGE,
+    EV_QUIT
+};
+
+/// a single event, which owns copies of all operands and strings it refers to
+struct Event {
+    EEventCode                  code;
+    int                         argId;
+    struct cl_loc               loc;
+    struct cl_insn              cli;
+    struct cl_operand           op[3];
+    const char                  *str[2];
+    int                         opCnt;
+    int                         strCnt;
+};
+
+const struct cl_operand* storeOp(Event &ev, const struct cl_operand *src)
+{
+    if (!src)
+        return 0;
+
+    struct cl_operand &dst = ev.op[ev.opCnt++];
+    storeOperand(dst, src);
+    return &dst;
+}
+
+const char* storeStr(Event &ev, const char *src)
+{
+    const char *&dst = ev.str[ev.strCnt++];
+    dst = src;
+    dupString(dst);
+    return dst;
+}
+
+void storeInsn(Event &ev, const struct cl_insn *cli)
+{
+    // shallow copy
+    ev.cli = *cli;
+
+    // now replace all the pointers by our own copies
+    const enum cl_insn_e code = cli->code;
+    switch (code) {
+        case CL_INSN_JMP:
+            ev.cli.data.insn_jmp.label =
+                storeStr(ev, cli->data.insn_jmp.label);
+            break;
+
+        case CL_INSN_COND:
+            ev.cli.data.insn_cond.src =
+                storeOp(ev, cli->data.insn_cond.src);
+            ev.cli.data.insn_cond.then_label =
+                storeStr(ev, cli->data.insn_cond.then_label);
+            ev.cli.data.insn_cond.else_label =
+                storeStr(ev, cli->data.insn_cond.else_label);
+            break;
+
+        case CL_INSN_RET:
+            ev.cli.data.insn_ret.src =
+                storeOp(ev, cli->data.insn_ret.src);
+            break;
+
+        case CL_INSN_UNOP:
+            ev.cli.data.insn_unop.dst =
+                storeOp(ev, cli->data.insn_unop.dst);
+            ev.cli.data.insn_unop.src =
+                storeOp(ev, cli->data.insn_unop.src);
+            break;
+
+        case CL_INSN_BINOP:
+            ev.cli.data.insn_binop.dst =
+                storeOp(ev, cli->data.insn_binop.dst);
+            ev.cli.data.insn_binop.src1 =
+                storeOp(ev, cli->data.insn_binop.src1);
+            ev.cli.data.insn_binop.src2 =
+                storeOp(ev, cli->data.insn_binop.src2);
+            break;
+
+        case CL_INSN_LABEL:
+            ev.cli.data.insn_label.name =
+                storeStr(ev, cli->data.insn_label.name);
+            break;
+
+        case CL_INSN_NOP:
+        case CL_INSN_ABORT:
+        case CL_INSN_CALL:
+        case CL_INSN_SWITCH:
+            break;
+    }
+}
+
+void releaseEvent(Event &ev)
+{
+    for (int i = 0; i < ev.opCnt; ++i)
+        releaseOperand(ev.op[i]);
+
+    for (int i = 0; i < ev.strCnt; ++i)
+        freeString(ev.str[i]);
+
+    ev.opCnt = 0;
+    ev.strCnt = 0;
+}
+
+void dispatchEvent(struct cl_code_listener *slave, const Event &ev)
+{
+    const struct cl_operand *const op = ev.op;
+    const char *const *const str = ev.str;
+
+    switch (ev.code) {
+        case EV_FILE_OPEN:
+            slave->file_open(slave, str[0]);
+            break;
+
+        case EV_FILE_CLOSE:
+            slave->file_close(slave);
+            break;
+
+        case EV_FNC_OPEN:
+            slave->fnc_open(slave, &op[0]);
+            break;
+
+        case EV_FNC_ARG_DECL:
+            slave->fnc_arg_decl(slave, ev.argId, &op[0]);
+            break;
+
+        case EV_FNC_CLOSE:
+            slave->fnc_close(slave);
+            break;
+
+        case EV_BB_OPEN:
+            slave->bb_open(slave, str[0]);
+            break;
+
+        case EV_INSN:
+            slave->insn(slave, &ev.cli);
+            break;
+
+        case EV_INSN_CALL_OPEN:
+            slave->insn_call_open(slave, &ev.loc, &op[0], &op[1]);
+            break;
+
+        case EV_INSN_CALL_ARG:
+            slave->insn_call_arg(slave, ev.argId, &op[0]);
+            break;
+
+        case EV_INSN_CALL_CLOSE:
+            slave->insn_call_close(slave);
+            break;
+
+        case EV_INSN_SWITCH_OPEN:
+            slave->insn_switch_open(slave, &ev.loc, &op[0]);
+            break;
+
+        case EV_INSN_SWITCH_CASE:
+            slave->insn_switch_case(slave, &ev.loc, &op[0], &op[1], str[0]);
+            break;
+
+        case EV_INSN_SWITCH_CLOSE:
+            slave->insn_switch_close(slave);
+            break;
+
+        case EV_ACKNOWLEDGE:
+            slave->acknowledge(slave);
+            break;
+
+        case EV_QUIT:
+            break;
+    }
+}
+
+} // namespace
+
+/// ICodeListener implementation running the slave listener in its own thread
+class ClAsync: public ICodeListener {
+    public:
+        ClAsync(struct cl_code_listener *slave);
+        virtual ~ClAsync();
+
+        virtual void file_open(
+            const char              *file_name)
+        {
+            Event &ev = this->acquireSlot(EV_FILE_OPEN);
+            storeStr(ev, file_name);
+            this->commitSlot();
+        }
+
+        virtual void file_close() {
+            this->acquireSlot(EV_FILE_CLOSE);
+            this->commitSlot();
+        }
+
+        virtual void fnc_open(
+            const struct cl_operand *fnc)
+        {
+            Event &ev = this->acquireSlot(EV_FNC_OPEN);
+            storeOp(ev, fnc);
+            this->commitSlot();
+        }
+
+        virtual void fnc_arg_decl(
+            int                     arg_id,
+            const struct cl_operand *arg_src)
+        {
+            Event &ev = this->acquireSlot(EV_FNC_ARG_DECL);
+            ev.argId = arg_id;
+            storeOp(ev, arg_src);
+            this->commitSlot();
+        }
+
+        virtual void fnc_close() {
+            this->acquireSlot(EV_FNC_CLOSE);
+            this->commitSlot();
+        }
+
+        virtual void bb_open(
+            const char              *bb_name)
+        {
+            Event &ev = this->acquireSlot(EV_BB_OPEN);
+            storeStr(ev, bb_name);
+            this->commitSlot();
+        }
+
+        virtual void insn(
+            const struct cl_insn    *cli)
+        {
+            Event &ev = this->acquireSlot(EV_INSN);
+            storeInsn(ev, cli);
+            this->commitSlot();
+        }
+
+        virtual void insn_call_open(
+            const struct cl_loc     *loc,
+            const struct cl_operand *dst,
+            const struct cl_operand *fnc)
+        {
+            Event &ev = this->acquireSlot(EV_INSN_CALL_OPEN);
+            ev.loc = *loc;
+            storeOp(ev, dst);
+            storeOp(ev, fnc);
+            this->commitSlot();
+        }
+
+        virtual void insn_call_arg(
+            int                     arg_id,
+            const struct cl_operand *arg_src)
+        {
+            Event &ev = this->acquireSlot(EV_INSN_CALL_ARG);
+            ev.argId = arg_id;
+            storeOp(ev, arg_src);
+            this->commitSlot();
+        }
+
+        virtual void insn_call_close() {
+            this->acquireSlot(EV_INSN_CALL_CLOSE);
+            this->commitSlot();
+        }
+
+        virtual void insn_switch_open(
+            const struct cl_loc     *loc,
+            const struct cl_operand *src)
+        {
+            Event &ev = this->acquireSlot(EV_INSN_SWITCH_OPEN);
+            ev.loc = *loc;
+            storeOp(ev, src);
+            this->commitSlot();
+        }
+
+        virtual void insn_switch_case(
+            const struct cl_loc     *loc,
+            const struct cl_operand *val_lo,
+            const struct cl_operand *val_hi,
+            const char              *label)
+        {
+            Event &ev = this->acquireSlot(EV_INSN_SWITCH_CASE);
+            ev.loc = *loc;
+            storeOp(ev, val_lo);
+            storeOp(ev, val_hi);
+            storeStr(ev, label);
+            this->commitSlot();
+        }
+
+        virtual void insn_switch_close() {
+            this->acquireSlot(EV_INSN_SWITCH_CLOSE);
+            this->commitSlot();
+        }
+
+        virtual void acknowledge() {
+            this->acquireSlot(EV_ACKNOWLEDGE);
+            this->commitSlot();
+        }
+
+    private:
+        Event& acquireSlot(EEventCode);
+        void commitSlot();
+        void consume();
+
+    private:
+        struct cl_code_listener     *slave_;
+        std::vector<Event>          queue_;
+
+        /// index of the next slot to consume, written by the worker only
+        std::atomic<size_t>         head_;
+
+        /// keep the indexes in separate cache lines
+        char                        pad_[64];
+
+        /// index of the next slot to produce, written by the caller only
+        std::atomic<size_t>         tail_;
+
+        std::thread                 worker_;
+};
+
+ClAsync::ClAsync(struct cl_code_listener *slave):
+    slave_(slave),
+    queue_(queueSize),
+    head_(0),
+    tail_(0)
+{
+    BOOST_FOREACH(Event &ev, queue_) {
+        ev.opCnt = 0;
+        ev.strCnt = 0;
+    }
+
+    worker_ = std::thread(&ClAsync::consume, this);
+}
+
+ClAsync::~ClAsync()
+{
+    // let the worker process all the pending events and wait for it
+    this->acquireSlot(EV_QUIT);
+    this->commitSlot();
+    worker_.join();
+
+    slave_->destroy(slave_);
+}
+
+Event& ClAsync::acquireSlot(EEventCode code)
+{
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    while (queueSize == tail - head_.load(std::memory_order_acquire))
+        // the queue is full, wait for the worker
+        std::this_thread::yield();
+
+    Event &ev = queue_[tail & (queueSize - 1)];
+    ev.code = code;
+    return ev;
+}
+
+void ClAsync::commitSlot()
+{
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    tail_.store(tail + 1, std::memory_order_release);
+}
+
+void ClAsync::consume()
+{
+    size_t head = head_.load(std::memory_order_relaxed);
+    int idle = 0;
+
+    for (;;) {
+        if (head == tail_.load(std::memory_order_acquire)) {
+            // the queue is empty, back off
+            if (++idle < spinLimit)
+                std::this_thread::yield();
+            else
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+
+            continue;
+        }
+
+        idle = 0;
+        Event &ev = queue_[head & (queueSize - 1)];
+        const bool quit = (EV_QUIT == ev.code);
+        dispatchEvent(slave_, ev);
+        releaseEvent(ev);
+
+        head_.store(++head, std::memory_order_release);
+        if (quit)
+            return;
+    }
+}
+
+// /////////////////////////////////////////////////////////////////////////////
+// public interface, see cl_async.hh for more details
+ICodeListener* createClAsync(struct cl_code_listener *slave)
+{
+    return new ClAsync(slave);
+}
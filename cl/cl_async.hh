@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of predator.
+ *
+ * predator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * predator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with predator.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef H_GUARD_CL_ASYNC_H
+#define H_GUARD_CL_ASYNC_H
+
+/**
+ * @file cl_async.hh
+ * constructor createClAsync() of a listener running in a separate thread
+ */
+
+struct cl_code_listener;
+class ICodeListener;
+
+/**
+ * create ICodeListener implementation, which forwards all events to the given
+ * listener running in a separate thread
+ * @param slave The listener to run asynchronously, it is destroyed together
+ * with the created object.
+ * @note The events are passed through a bounded lock-free queue.  Operands and
+ * strings are copied, types, variables and locations need to stay valid until
+ * the created object is destroyed.
+ */
+ICodeListener* createClAsync(struct cl_code_listener *slave);
+
+#endif /* H_GUARD_CL_ASYNC_H */
@@ -26,6 +26,7 @@
 #include <cl/cl_msg.hh>
 
 #include "cl.hh"
+#include "cl_async.hh"
 #include "cl_private.hh"
 
 #include <boost/foreach.hpp>
@@ -84,6 +85,7 @@ class ClChain: public ICodeListener {
 
     public:
         void append(cl_code_listener *);
+        void appendAsync(cl_code_listener *);
 
     private:
         std::vector<cl_code_listener *> list_;
@@ -113,6 +115,11 @@ void ClChain::append(cl_code_listener *item)
     list_.push_back(item);
 }
 
+void ClChain::appendAsync(cl_code_listener *item)
+{
+    list_.push_back(cl_create_listener_wrap(createClAsync(item)));
+}
+
 void ClChain::file_open(
             const char              *file_name)
 {
@@ -228,3 +235,20 @@ void cl_chain_append(
         CL_DIE("uncaught exception in cl_chain_append");
     }
 }
+
+void cl_chain_append_async(
+        struct cl_code_listener      *self,
+        struct cl_code_listener      *item)
+{
+    try {
+        ICodeListener *listener = cl_obtain_from_wrap(self);
+        ClChain *chain = dynamic_cast<ClChain *>(listener);
+        if (!chain)
+            CL_DIE("failed to downcast ICodeListener to ClChain");
+
+        chain->appendAsync(item);
+    }
+    catch (...) {
+        CL_DIE("uncaught exception in cl_chain_append_async");
+    }
+}
@@ -24,6 +24,7 @@
 #include <cl/easy.hh>
 #include <cl/killer.hh>
 #include <cl/memdebug.hh>
+#include <cl/perfstats.hh>
 #include <cl/storage.hh>
 
 #include "callgraph.hh"
@@ -62,24 +63,39 @@ class ClEasy: public ClStorageBuilder {
             }
 
             CL_DEBUG("building call-graph...");
-            CodeStorage::CallGraph::buildCallGraph(stor);
+            {
+                PERF_TIMER("cl.call_graph");
+                CodeStorage::CallGraph::buildCallGraph(stor);
+            }
             printMemUsage("buildCallGraph");
 
             CL_DEBUG("scanning CFG for loop-closing edges...");
-            findLoopClosingEdges(stor);
+            {
+                PERF_TIMER("cl.loop_scan");
+                findLoopClosingEdges(stor);
+            }
             printMemUsage("findLoopClosingEdges");
 
             CL_DEBUG("perform points-to analysis...");
-            pointsToAnalyse(stor, configString_);
+            {
+                PERF_TIMER("cl.points_to");
+                pointsToAnalyse(stor, configString_);
+            }
             printMemUsage("pointsToAnalyse");
 
             CL_DEBUG("killing local variables...");
-            killLocalVariables(stor);
+            {
+                PERF_TIMER("cl.killer");
+                killLocalVariables(stor);
+            }
             printMemUsage("killLocalVariables");
 
             CL_DEBUG("ClEasy is calling the analyzer...");
             StopWatch watch;
-            clEasyRun(stor, configString_.c_str());
+            {
+                PERF_TIMER("cl.analysis");
+                clEasyRun(stor, configString_.c_str());
+            }
             CL_PRINT_TIME(watch);
         }
 
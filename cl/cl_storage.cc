@@ -21,6 +21,7 @@
 #include "cl_storage.hh"
 
 #include <cl/clutil.hh>
+#include <cl/perfstats.hh>
 #include <cl/storage.hh>
 
 #include "builtins.hh"
@@ -573,6 +574,7 @@ void ClStorageBuilder::file_close()
 
 void ClStorageBuilder::fnc_open(const struct cl_operand *op)
 {
+    PERF_TIMER("cl.storage");
     if (CL_OPERAND_CST != op->code)
         CL_TRAP;
 
@@ -603,6 +605,7 @@ void ClStorageBuilder::fnc_open(const struct cl_operand *op)
 
 void ClStorageBuilder::fnc_arg_decl(int pos, const struct cl_operand *op)
 {
+    PERF_TIMER("cl.storage");
     if (CL_OPERAND_VAR != op->code)
         CL_TRAP;
 
@@ -624,12 +627,14 @@ void ClStorageBuilder::fnc_close()
 
 void ClStorageBuilder::bb_open(const char *bb_name)
 {
+    PERF_TIMER("cl.storage");
     ControlFlow &cfg = d->fnc->cfg;
     d->bb = cfg[bb_name];
 }
 
 void ClStorageBuilder::insn(const struct cl_insn *cli)
 {
+    PERF_TIMER("cl.storage");
     if (!d->bb)
         // FIXME: this simply ignores 'jump to entry' insn
         return;
@@ -648,6 +653,7 @@ void ClStorageBuilder::insn_call_open(
     const struct cl_operand *dst,
     const struct cl_operand *fnc)
 {
+    PERF_TIMER("cl.storage");
     Insn *insn = new Insn;
     insn->code = CL_INSN_CALL;
     insn->loc = *loc;
@@ -666,6 +672,7 @@ void ClStorageBuilder::insn_call_open(
 
 void ClStorageBuilder::insn_call_arg(int, const struct cl_operand *arg_src)
 {
+    PERF_TIMER("cl.storage");
     TOperandList &operands = d->insn->operands;
     unsigned idx = operands.size();
     operands.resize(idx + 1);
@@ -674,6 +681,7 @@ void ClStorageBuilder::insn_call_arg(int, const struct cl_operand *arg_src)
 
 void ClStorageBuilder::insn_call_close()
 {
+    PERF_TIMER("cl.storage");
     d->closeInsn();
 
     // switch back preventing for next instructions
@@ -684,6 +692,7 @@ void ClStorageBuilder::insn_switch_open(
     const struct cl_loc     *loc,
     const struct cl_operand *src)
 {
+    PERF_TIMER("cl.storage");
     Insn *insn = new Insn;
     insn->code = CL_INSN_SWITCH;
     insn->loc = *loc;
@@ -705,6 +714,7 @@ void ClStorageBuilder::insn_switch_case(
     const struct cl_operand *val_hi,
     const char              *label)
 {
+    PERF_TIMER("cl.storage");
     ControlFlow &cfg = d->fnc->cfg;
     Insn &insn = *d->insn;
     TTargetList &targets = insn.targets;
@@ -756,5 +766,6 @@ void ClStorageBuilder::insn_switch_case(
 
 void ClStorageBuilder::insn_switch_close()
 {
+    PERF_TIMER("cl.storage");
     d->closeInsn();
 }
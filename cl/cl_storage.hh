@@ -32,6 +32,18 @@ namespace CodeStorage {
     struct Insn;
 
     void destroyInsn(Insn *insn);
+
+    /// strdup(3) the given string in place (NULL is kept as NULL)
+    void dupString(const char *&str);
+
+    /// free a string formerly duplicated by dupString()
+    void freeString(const char *str);
+
+    /// deep copy of a cl_operand object (types and variables are shared)
+    void storeOperand(struct cl_operand &dst, const struct cl_operand *src);
+
+    /// free all data allocated previously by storeOperand()
+    void releaseOperand(struct cl_operand &ref);
 }
 
 /**
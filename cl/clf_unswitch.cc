@@ -169,9 +169,10 @@ struct cl_var* ClfUnfoldSwitch::acquireClVar()
     return clv;
 }
 
-void ClfUnfoldSwitch::emitCase(int cst, struct cl_type *type, const char *label)
+static struct cl_type createBoolType()
 {
-    static struct cl_type btype;
+    struct cl_type btype;
+    NULLIFY(btype);
     btype.uid                       = /* FIXME */ 0x200000;
     btype.code                      = CL_TYPE_BOOL;
     btype.loc.file                  = 0;
@@ -179,6 +180,13 @@ void ClfUnfoldSwitch::emitCase(int cst, struct cl_type *type, const char *label)
     btype.scope                     = CL_SCOPE_GLOBAL;
     btype.name                      = "<builtin_bool>";
     btype.size                      = /* FIXME */ sizeof(bool);
+    return btype;
+}
+
+void ClfUnfoldSwitch::emitCase(int cst, struct cl_type *type, const char *label)
+{
+    // initialized only once, the filter may run in multiple threads
+    static struct cl_type btype = createBoolType();
 
     struct cl_operand reg;
     NULLIFY(reg);
@@ -29,6 +29,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <mutex>
 
 #include <unistd.h>
 
@@ -91,25 +92,32 @@ static struct cl_init_data init_data = {
     0                      // .debug_level
 };
 
+// listeners appended by cl_chain_append_async() emit messages from own threads
+static std::mutex msg_lock;
+
 void cl_debug(const char *msg)
 {
+    std::lock_guard<std::mutex> guard(msg_lock);
     init_data.debug(msg);
 }
 
 void cl_warn(const char *msg)
 {
+    std::lock_guard<std::mutex> guard(msg_lock);
     CHK_LAST(msg, /* filter */ true);
     init_data.warn(msg);
 }
 
 void cl_error(const char *msg)
 {
+    std::lock_guard<std::mutex> guard(msg_lock);
     CHK_LAST(msg, /* filter */ true);
     init_data.error(msg);
 }
 
 void cl_note(const char *msg)
 {
+    std::lock_guard<std::mutex> guard(msg_lock);
     CHK_LAST(msg, /* filter */ false);
     init_data.note(msg);
 }
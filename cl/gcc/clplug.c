@@ -226,10 +226,14 @@ static struct plugin_info cl_info = {
 "    -fplugin-arg-%s-help\n"
 "    -fplugin-arg-%s-version\n"
 "    -fplugin-arg-%s-args=PEER_ARGS                 args given to analyzer\n"
+"    -fplugin-arg-%s-async                          run dump-pp/gen-dot/type-dot\n"
+"                                                   in separate threads\n"
 "    -fplugin-arg-%s-dry-run                        do not run the analyzer\n"
 "    -fplugin-arg-%s-dump-pp[=OUTPUT_FILE]          dump linearized code\n"
 "    -fplugin-arg-%s-dump-types                     dump also type info\n"
 "    -fplugin-arg-%s-gen-dot[=GLOBAL_CG_FILE]       generate CFGs\n"
+"    -fplugin-arg-%s-perf-stats=FILE                write performance stats\n"
+"                                                   to FILE (JSON or *.csv)\n"
 "    -fplugin-arg-%s-pid-file=FILE                  write PID of self to FILE\n"
 "    -fplugin-arg-%s-preserve-ec                    do not affect exit code\n"
 "    -fplugin-arg-%s-type-dot=TYPE_GRAPH_FILE       generate type graphs\n"
@@ -280,7 +284,8 @@ static void init_plugin_name(const struct plugin_name_args *info)
     if (-1 == asprintf(&msg, cl_info.help, plugin_base_name,
                        name, name, name, name,
                        name, name, name, name,
-                       name, name, name, name))
+                       name, name, name, name,
+                       name, name))
         // OOM
         abort();
     else
@@ -301,6 +306,7 @@ static void free_plugin_name(void)
 
 // FIXME: suboptimal interface of CL messaging
 static bool preserve_ec;
+static const char *perf_stats_file;
 static int cnt_errors;
 static int cnt_warnings;
 
@@ -2084,6 +2090,9 @@ static void cb_finish(void *gcc_data __attribute__((unused)),
         // this should trigger the code listener analyzer (if any)
         cl->acknowledge(cl);
 
+    if (perf_stats_file && !cl_perf_stats_export(perf_stats_file))
+        CL_WARN("failed to export performance stats");
+
     // FIXME: suboptimal interface of CL messaging
     if (!preserve_ec) {
         if (cnt_errors) {
@@ -2154,6 +2163,7 @@ static void cl_regcb(const char *name) {
 }
 
 struct cl_plug_options {
+    bool                    async_listeners;
     bool                    dump_types;
     bool                    use_dotgen;
     bool                    use_pp;
@@ -2205,6 +2215,10 @@ static int clplug_init(const struct plugin_name_args *info,
                 ? value
                 : "";
         }
+        else if (STREQ(key, "async")) {
+            opt->async_listeners = true;
+            // TODO: warn about ignoring extra value?
+        }
         else if (STREQ(key, "dry-run")) {
             opt->use_analyzer   = false;
             // TODO: warn about ignoring extra value?
@@ -2226,6 +2240,15 @@ static int clplug_init(const struct plugin_name_args *info,
             preserve_ec = true;
             // TODO: warn about ignoring extra value?
         }
+        else if (STREQ(key, "perf-stats")) {
+            // FIXME: do not use gl variable, use the pointer user_data instead
+            if (value)
+                perf_stats_file = value;
+            else {
+                CL_ERROR("mandatory value omitted for perf-stats");
+                return EXIT_FAILURE;
+            }
+        }
         else if (STREQ(key, "pid-file")) {
             if (value)
                 opt->pid_file = value;
@@ -2254,7 +2277,7 @@ static int clplug_init(const struct plugin_name_args *info,
     return EXIT_SUCCESS;
 }
 
-static bool cl_append_listener(struct cl_code_listener *chain,
+static bool cl_append_listener(struct cl_code_listener *chain, bool async,
                                const char *fmt, ...)
 {
     va_list ap;
@@ -2274,7 +2297,11 @@ static bool cl_append_listener(struct cl_code_listener *chain,
         return false;
     }
 
-    cl_chain_append(chain, cl);
+    if (async)
+        cl_chain_append_async(chain, cl);
+    else
+        cl_chain_append(chain, cl);
+
     return true;
 }
 
@@ -2286,7 +2313,10 @@ static bool cl_append_def_listener(struct cl_code_listener *chain,
         ? "unfold_switch,unify_labels_gl"
         : "unify_labels_fnc";
 
-    return cl_append_listener(chain,
+    // only the analyzer itself is notified synchronously
+    const bool async = opt->async_listeners && !STREQ(listener, "easy");
+
+    return cl_append_listener(chain, async,
             "listener=\"%s\" listener_args=\"%s\" clf=\"%s\"",
             listener, args, clf);
 }
@@ -2300,7 +2330,7 @@ create_cl_chain(const struct cl_plug_options *opt)
         return NULL;
 
 #if CL_DEBUG_LOCATION
-    if (!cl_append_listener(chain, "listener=\"locator\""))
+    if (!cl_append_listener(chain, /* async */ false, "listener=\"locator\""))
         return NULL;
 #endif
 
@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of llvm/predator.
+ *
+ * predator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * predator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with predator.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+extern "C" {
+#include <cl/code_listener.h>
+
+#include "../config_cl.h"
+
+#include <sys/wait.h> // waitpid
+#include <unistd.h> // fork
+}
+
+#include <cl/cl_msg.hh>
+#include "clplug.hh"
+
+#include "llvm/IRReader/IRReader.h"
+#include "llvm/PassManager.h"
+#include "llvm/Support/ManagedStatic.h"
+#include "llvm/Support/SourceMgr.h"
+#include "llvm/Transforms/Scalar.h"
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @file cldriver.cc
+ * stand-alone driver, which analyses a batch of bitcode files in one process
+ *
+ * The LLVM context, the registered passes and the CL callbacks are initialized
+ * only once.  Each module is then translated by CLPass into its own storage and
+ * handed over to the analyzer.  With -jobs=N the modules are distributed among
+ * N worker processes forked after the initialization is done.
+ */
+
+using namespace llvm;
+
+typedef std::vector<std::string> TFileList;
+
+/// Command line options of the driver (in addition to those of CLPass)
+static cl::list<std::string> CLInputFiles(cl::Positional,
+        cl::desc("<input bitcode files>"),
+        cl::ZeroOrMore);
+static cl::opt<std::string> CLFileList("file-list",
+        cl::desc("Read names of bitcode files from <filename>, one per line"),
+        cl::ValueRequired,
+        cl::value_desc("filename"),
+        cl::cat(CLOptionCategory));
+static cl::opt<unsigned> CLJobs("jobs",
+        cl::desc("Analyze the modules in <uint> worker processes"),
+        cl::ValueRequired,
+        cl::value_desc("uint"),
+        cl::init(1), cl::cat(CLOptionCategory));
+
+/// collect names of the input files from the command line and -file-list
+static void collectInputFiles(TFileList &dst) {
+
+    dst.insert(dst.end(), CLInputFiles.begin(), CLInputFiles.end());
+
+    if (CLFileList.empty())
+        return;
+
+    std::ifstream file(CLFileList.c_str());
+    if (!file) {
+        CL_ERROR("failed to open file list: " << CLFileList);
+        return;
+    }
+
+    std::string line;
+    while (std::getline(file, line))
+        if (!line.empty())
+            dst.push_back(line);
+}
+
+/// translate one module by CLPass and run the analyzer on the result
+static void analyzeModule(LLVMContext &ctx, const std::string &fileName) {
+
+    SMDiagnostic err;
+    std::unique_ptr<Module> M(ParseIRFile(fileName, err, ctx));
+    if (!M) {
+        err.print(plugName.c_str(), errs());
+        CL_ERROR("failed to load bitcode file: " << fileName);
+        return;
+    }
+
+    CL_DEBUG("driver analyzes Module " << fileName);
+
+    // the pass manager takes ownership of the passes, equal to "opt -lowerswitch"
+    PassManager PM;
+    PM.add(createLowerSwitchPass());
+    PM.add(new CLPass(/* batch */ true));
+    PM.run(*M);
+}
+
+/// analyze each step-th module, starting by the one at the given offset
+static void analyzeBatch(
+        LLVMContext                 &ctx,
+        const TFileList             &files,
+        const unsigned              offset,
+        const unsigned              step)
+{
+    for (unsigned i = offset; i < files.size(); i += step)
+        analyzeModule(ctx, files[i]);
+}
+
+/// distribute the modules among worker processes and wait for them
+static void runWorkers(LLVMContext &ctx, const TFileList &files, unsigned jobs) {
+
+    std::vector<pid_t> workers;
+
+    for (unsigned i = 0; i < jobs; ++i) {
+        const pid_t pid = fork();
+        if (-1 == pid) {
+            // analyze the share of the missing worker by ourselves
+            CL_WARN("fork() failed, analyzing in the main process");
+            analyzeBatch(ctx, files, i, jobs);
+            continue;
+        }
+
+        if (!pid) {
+            // worker process, the exit code is set by globalCleanup()
+            analyzeBatch(ctx, files, i, jobs);
+            CLPass::globalCleanup(/* worker */ i);
+            exit(EXIT_SUCCESS);
+        }
+
+        workers.push_back(pid);
+    }
+
+    for (const pid_t pid : workers) {
+        int status;
+        if (-1 == waitpid(pid, &status, 0))
+            CL_ERROR("waitpid() failed for worker " << pid);
+        else if (!WIFEXITED(status) || WEXITSTATUS(status))
+            CL_ERROR("worker " << pid << " has not succeeded");
+    }
+}
+
+int main(int argc, char **argv) {
+
+    llvm_shutdown_obj shutdown; // call llvm_shutdown() on exit
+
+    const std::string overview = "Code Listener Analyzer for bitcode files ("
+        + plugName + ")\n";
+    cl::ParseCommandLineOptions(argc, argv, overview.c_str());
+
+    LLVMContext &ctx = getGlobalContext();
+    CLPass::globalInit();
+
+    TFileList files;
+    collectInputFiles(files);
+    if (files.empty())
+        CL_WARN("no input files given");
+
+    unsigned jobs = CLJobs;
+    if (files.size() < jobs)
+        jobs = files.size();
+
+    if (jobs < 2)
+        analyzeBatch(ctx, files, /* offset */ 0, /* step */ 1);
+    else
+        runWorkers(ctx, files, jobs);
+
+    CLPass::globalCleanup();
+    return EXIT_SUCCESS;
+}
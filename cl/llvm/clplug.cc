@@ -133,6 +133,9 @@ cl::opt<std::string> CLArgs("args",
         cl::ValueRequired,
         cl::value_desc("peer-args"),
         cl::cat(CLOptionCategory));
+static cl::opt<bool> CLAsync("async",
+        cl::desc("Run dump-pp, gen-dot and type-dot in separate threads"),
+        cl::init(false), cl::cat(CLOptionCategory));
 static cl::opt<bool> CLDryRun("dry-run",
         cl::desc("Do not run the analyzer"),
         cl::init(false), cl::cat(CLOptionCategory));
@@ -149,6 +152,11 @@ static cl::opt<std::string> CLGenFilename("gen-dot",
         cl::ValueOptional,
         cl::value_desc("filename"),
         cl::init("-"), cl::cat(CLOptionCategory));
+static cl::opt<std::string> CLPerfFilename("perf-stats",
+        cl::desc("Write performance stats to <filename> (JSON or *.csv)"),
+        cl::ValueRequired,
+        cl::value_desc("filename"),
+        cl::cat(CLOptionCategory));
 static cl::opt<std::string> CLPIDFilename("pid-file",
         cl::desc("Write PID of self to <filename>"),
         cl::ValueRequired,
@@ -239,10 +247,6 @@ void CLPass::freeAccessor(struct cl_accessor *acc) {
 /// create CL object for grouping another CL objects by command line options
 void CLPass::setup(void) {
 
-    /* void */ cl::ParseEnvironmentOptions("opt",plugName.c_str());
-
-    writePID();
-
     // alloc CL object --> use Dudka's code
     cl = cl_chain_create();
     if (!cl) exit(EXIT_FAILURE); //return false;
@@ -258,21 +262,21 @@ void CLPass::setup(void) {
         configCL = "listener=\"";
         configCL += ((CLDumpType)? "pp_with_types" : "pp");
         configCL += "\" listener_args=\""+ CLPPFilename +"\" clf=\""+ cfg +"\"";
-        appendListener(configCL.c_str());
+        appendListener(configCL.c_str(), CLAsync);
         configCL.clear();
     }
 
     if (CLGenFilename != "-") {
         configCL = "listener=\"dotgen\" listener_args=\""+ CLGenFilename
             +"\" clf=\""+ cfg +"\"";
-        appendListener(configCL.c_str());
+        appendListener(configCL.c_str(), CLAsync);
         configCL.clear();
     }
 
     if (!CLTypeFilename.empty()) {
         configCL = "listener=\"typedot\" listener_args=\""+ CLTypeFilename
             +"\" clf=\""+ cfg +"\"";
-        appendListener(configCL.c_str());
+        appendListener(configCL.c_str(), CLAsync);
         configCL.clear();
     }
 
@@ -287,13 +291,15 @@ void CLPass::setup(void) {
 
 }
 
-/// append CL object 
-void CLPass::appendListener(const char *config) {
+/// append CL object, async objects are notified in a separate thread
+void CLPass::appendListener(const char *config, bool async) {
     struct cl_code_listener *cl_new = cl_code_listener_create(config);
 
     if (!cl_new) {
         cl->destroy(cl);
         exit(EXIT_FAILURE); //return false;
+    } else if (async) {
+        cl_chain_append_async(cl, cl_new);
     } else {
         cl_chain_append(cl, cl_new);
     }
@@ -316,8 +322,8 @@ void CLPass::writePID(void) {
 }
 
 
-/// initialization CL before pass is run, setup callbacks for message
-bool CLPass::doInitialization(Module &) {
+/// one-time initialization of CL, setup callbacks for message
+void CLPass::globalInit(void) {
 
     // callbacks for messages
     struct cl_init_data data = {
@@ -332,6 +338,61 @@ bool CLPass::doInitialization(Module &) {
 
     cl_global_init(&data);
 
+    /* void */ cl::ParseEnvironmentOptions("opt",plugName.c_str());
+
+    writePID();
+}
+
+/// write performance stats, each worker of the driver into its own file
+static void exportPerfStats(int worker) {
+
+    if (CLPerfFilename.empty())
+        return;
+
+    std::string fileName = CLPerfFilename;
+    if (-1 != worker) {
+        // "stats.json" -> "stats.1.json"
+        std::string::size_type pos = fileName.rfind('.');
+        if (std::string::npos == pos
+                || std::string::npos != fileName.find('/', pos))
+            pos = fileName.size();
+
+        fileName.insert(pos, "." + std::to_string(worker));
+    }
+
+    if (!cl_perf_stats_export(fileName.c_str()))
+        CL_WARN("failed to export performance stats");
+}
+
+/// one-time clean up of CL, setup exit code
+void CLPass::globalCleanup(int worker) {
+
+    exportPerfStats(worker);
+    cl_global_cleanup();
+
+    //used Dudka's code
+
+    if (!CLPreserve) {
+        if (CLPrint::cntErrors) {
+            // this causes non-zero exit code
+            CL_ERROR("Pass has detected some errors");
+            exit(EXIT_FAILURE);
+        }
+        else if (CLPrint::cntWarnings) {
+            // this causes non-zero exit code in case of -Werror
+            CL_ERROR("Pass has reported some warnings");
+            exit(EXIT_FAILURE);
+        }
+    }
+}
+
+/// initialization CL before pass is run
+bool CLPass::doInitialization(Module &) {
+
+    // the stand-alone driver initializes CL only once for all modules
+    if (!batch)
+        globalInit();
+
     setup();
 
     CL_DEBUG("pass successfully initialized");
@@ -1559,31 +1620,19 @@ void CLPass::handleCallInstruction(CallInst *I) {
     cl->insn_call_close(cl);
 }
 
-/// last function, clean up after pass, set CL on valid and setup exit code
+/// last function, clean up after pass, set CL on valid
 bool CLPass::doFinalization (Module &) {
 
     // CL is valid
     cl->acknowledge(cl);
 
     cl->destroy(cl);
-    cl_global_cleanup();
     freeTypeTable();
     freeVarTable();
 
-    //used Dudka's code
-
-    if (!CLPreserve) {
-        if (CLPrint::cntErrors) {
-            // this causes non-zero exit code
-            CL_ERROR("Pass has detected some errors");
-            exit(EXIT_FAILURE);
-        }
-        else if (CLPrint::cntWarnings) {
-            // this causes non-zero exit code in case of -Werror
-            CL_ERROR("Pass has reported some warnings");
-            exit(EXIT_FAILURE);
-        }
-    }
+    // the stand-alone driver cleans up once all modules are analysed
+    if (!batch)
+        globalCleanup();
 
     return true;
 }
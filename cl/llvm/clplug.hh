@@ -35,6 +35,7 @@ extern "C" {
 #include "llvm/IR/IntrinsicInst.h"
 #include "llvm/IR/LLVMContext.h"
 #include "llvm/Pass.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/raw_ostream.h"
 
 #include <unordered_map>
@@ -44,6 +45,9 @@ extern std::string plugName;// = "cl";
 
 using namespace llvm;
 
+/// category of the command line options shared by the pass and the driver
+extern cl::OptionCategory CLOptionCategory;
+
 //===----------------------------------------------------------------------===//
 /// CLPrint struct - callbacks for plug-in messages
 ///
@@ -118,17 +122,23 @@ struct CLPass : public ModulePass {
         VarMap VarTable;     ///< Table for values
         DataLayout *DL;
         struct cl_code_listener *cl;///< Code Listener object
+        bool batch;          ///< global init/cleanup is done by the driver
 
     public:
-        CLPass() : ModulePass(ID) {}
+        /// @param batch true if the pass is run by the stand-alone driver
+        explicit CLPass(bool batch = false) : ModulePass(ID), batch(batch) {}
         virtual bool doInitialization(Module &);
         virtual bool runOnModule(Module &);
         virtual bool doFinalization(Module &);
 
+        static void globalInit(void);
+        /// @param worker index inserted into the name of the perf-stats file
+        static void globalCleanup(int worker = -1);
+
     private:
         void setup(void);
-        void writePID(void);
-        void appendListener(const char *);
+        static void writePID(void);
+        void appendListener(const char *, bool async = false);
 
         struct cl_loc findLoc(Instruction *);
 
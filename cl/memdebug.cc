@@ -134,6 +134,15 @@ bool printPeakMemUsage()
     return true;
 }
 
+bool peakMemUsage(ssize_t *pDst)
+{
+    if (::overflowDetected)
+        return false;
+
+    *pDst = ::peak - ::memDrift;
+    return true;
+}
+
 #else // DEBUG_MEM_USAGE
 
 bool rawMemUsage(ssize_t *)
@@ -161,4 +170,9 @@ bool printPeakMemUsage()
     return false;
 }
 
+bool peakMemUsage(ssize_t *)
+{
+    return false;
+}
+
 #endif
@@ -0,0 +1,250 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of predator.
+ *
+ * predator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * predator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with predator.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config_cl.h"
+
+#include <cl/cl_msg.hh>
+#include <cl/code_listener.h>
+#include <cl/memdebug.hh>
+#include <cl/perfstats.hh>
+
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+
+#include <boost/foreach.hpp>
+
+namespace PerfStats {
+
+void Timer::add(double sec)
+{
+    ++this->calls;
+    this->total += sec;
+    if (this->max < sec)
+        this->max = sec;
+}
+
+Histogram::Histogram():
+    count(0),
+    sum(0),
+    min(0),
+    max(0)
+{
+    for (int i = 0; i < BUCKETS; ++i)
+        buckets[i] = 0;
+}
+
+void Histogram::add(long long value)
+{
+    if (!this->count || value < this->min)
+        this->min = value;
+    if (!this->count || this->max < value)
+        this->max = value;
+
+    ++this->count;
+    this->sum += value;
+
+    // compute the index of the bucket
+    int idx = 0;
+    for (unsigned long long val = value; 0 < value && val; val >>= 1)
+        ++idx;
+
+    if (BUCKETS <= idx)
+        idx = BUCKETS - 1;
+
+    ++this->buckets[idx];
+}
+
+struct Registry {
+    typedef std::map<std::string, Counter>          TCounters;
+    typedef std::map<std::string, Timer>            TTimers;
+    typedef std::map<std::string, Histogram>        THistograms;
+
+    /// guards only the look-up, the values are updated by the analyzer thread
+    std::mutex          lock;
+    TCounters           counters;
+    TTimers             timers;
+    THistograms         histograms;
+
+    static Registry& instance() {
+        static Registry reg;
+        return reg;
+    }
+};
+
+Counter& counter(const std::string &name)
+{
+    Registry &reg = Registry::instance();
+    std::lock_guard<std::mutex> guard(reg.lock);
+    return reg.counters[name];
+}
+
+Timer& timer(const std::string &name)
+{
+    Registry &reg = Registry::instance();
+    std::lock_guard<std::mutex> guard(reg.lock);
+    return reg.timers[name];
+}
+
+Histogram& histogram(const std::string &name)
+{
+    Registry &reg = Registry::instance();
+    std::lock_guard<std::mutex> guard(reg.lock);
+    return reg.histograms[name];
+}
+
+/// lower bound of the values counted by the given bucket of Histogram
+long long bucketBase(int idx)
+{
+    return (idx)
+        ? (1LL << (idx - 1))
+        : 0LL;
+}
+
+void writeJson(std::ostream &str, const Registry &reg)
+{
+    str << "{\n    \"counters\": {";
+    const char *sep = "\n";
+    BOOST_FOREACH(Registry::TCounters::const_reference item, reg.counters) {
+        str << sep << "        \"" << item.first << "\": "
+            << item.second.value;
+        sep = ",\n";
+    }
+
+    str << "\n    },\n    \"timers\": {";
+    sep = "\n";
+    BOOST_FOREACH(Registry::TTimers::const_reference item, reg.timers) {
+        const Timer &tm = item.second;
+        str << sep << "        \"" << item.first << "\": { "
+            << "\"calls\": "    << tm.calls << ", "
+            << "\"total\": "    << tm.total << ", "
+            << "\"max\": "      << tm.max   << " }";
+        sep = ",\n";
+    }
+
+    str << "\n    },\n    \"histograms\": {";
+    sep = "\n";
+    BOOST_FOREACH(Registry::THistograms::const_reference item, reg.histograms) {
+        const Histogram &hg = item.second;
+        str << sep << "        \"" << item.first << "\": { "
+            << "\"count\": "    << hg.count << ", "
+            << "\"sum\": "      << hg.sum   << ", "
+            << "\"min\": "      << hg.min   << ", "
+            << "\"max\": "      << hg.max   << ", "
+            << "\"buckets\": {";
+
+        const char *bsep = " ";
+        for (int i = 0; i < Histogram::BUCKETS; ++i) {
+            if (!hg.buckets[i])
+                continue;
+
+            str << bsep << "\"" << bucketBase(i) << "\": " << hg.buckets[i];
+            bsep = ", ";
+        }
+
+        str << " } }";
+        sep = ",\n";
+    }
+
+    str << "\n    }\n}\n";
+}
+
+void writeCsv(std::ostream &str, const Registry &reg)
+{
+    str << "kind,name,field,value\n";
+
+    BOOST_FOREACH(Registry::TCounters::const_reference item, reg.counters)
+        str << "counter," << item.first << ",value,"
+            << item.second.value << "\n";
+
+    BOOST_FOREACH(Registry::TTimers::const_reference item, reg.timers) {
+        const Timer &tm = item.second;
+        str << "timer," << item.first << ",calls," << tm.calls << "\n"
+            << "timer," << item.first << ",total," << tm.total << "\n"
+            << "timer," << item.first << ",max,"   << tm.max   << "\n";
+    }
+
+    BOOST_FOREACH(Registry::THistograms::const_reference item, reg.histograms) {
+        const Histogram &hg = item.second;
+        const std::string &name = item.first;
+        str << "histogram," << name << ",count," << hg.count << "\n"
+            << "histogram," << name << ",sum,"   << hg.sum   << "\n"
+            << "histogram," << name << ",min,"   << hg.min   << "\n"
+            << "histogram," << name << ",max,"   << hg.max   << "\n";
+
+        for (int i = 0; i < Histogram::BUCKETS; ++i) {
+            if (hg.buckets[i])
+                str << "histogram," << name << ",bucket_" << bucketBase(i)
+                    << "," << hg.buckets[i] << "\n";
+        }
+    }
+}
+
+bool endsWith(const std::string &str, const std::string &suffix)
+{
+    return suffix.size() <= str.size()
+        && !str.compare(str.size() - suffix.size(), suffix.size(), suffix);
+}
+
+bool exportToFile(const std::string &fileName)
+{
+    // peak memory usage is available only if DEBUG_MEM_USAGE is enabled
+    ssize_t peak;
+    if (peakMemUsage(&peak) && 0 < peak)
+        counter("mem.peak").value = peak;
+
+    std::ofstream str(fileName.c_str(), std::ios::out);
+    if (!str) {
+        CL_ERROR("failed to open '" << fileName << "' for writing");
+        return false;
+    }
+
+    str << std::setprecision(6) << std::fixed;
+
+    Registry &reg = Registry::instance();
+    std::lock_guard<std::mutex> guard(reg.lock);
+    if (endsWith(fileName, ".csv"))
+        writeCsv(str, reg);
+    else
+        writeJson(str, reg);
+
+    str.flush();
+    if (!str) {
+        CL_ERROR("failed to write performance stats to '" << fileName << "'");
+        return false;
+    }
+
+    CL_DEBUG("performance stats written to '" << fileName << "'");
+    return true;
+}
+
+} // namespace PerfStats
+
+// /////////////////////////////////////////////////////////////////////////////
+// public interface, see code_listener.h for more details
+bool cl_perf_stats_export(const char *file_name)
+{
+    try {
+        return PerfStats::exportToFile(file_name);
+    }
+    catch (...) {
+        CL_DIE("uncaught exception in cl_perf_stats_export");
+    }
+}
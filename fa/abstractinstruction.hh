@@ -167,6 +167,30 @@ public:
 	virtual std::ostream& toStream(std::ostream& os) const = 0;
 
 
+	/**
+	 * @brief  Gets the instructions the execution may continue with
+	 *
+	 * The successors that are known only at run time, e.g. the return address
+	 * of a function, are not included.
+	 *
+	 * @param[out]  dst  The vector the successors are appended to
+	 */
+	virtual void successors(std::vector<const AbstractInstruction*>& /* dst */) const
+	{ }
+
+
+	/**
+	 * @brief  Gets the return addresses loaded by the instruction
+	 *
+	 * The instruction that loads a return address is followed by the entry of
+	 * the called function, whose return continues at the loaded address.
+	 *
+	 * @param[out]  dst  The vector the return addresses are appended to
+	 */
+	virtual void returnAddresses(std::vector<const AbstractInstruction*>& /* dst */) const
+	{ }
+
+
 	/**
 	 * @brief  Gets the instruction from CL's code storage
 	 *
@@ -138,11 +138,11 @@ Box::Box(
 	StructuralBox(box_type_e::bBox, selectors.size()),
 	name_(name),
 	hint_(),
-	output_(output),
+	output_(ComponentMan::instance().intern(output)),
 	outputSignature_(outputSignature),
 	outputLabels_(),
 	inputMap_(inputMap),
-	input_(input),
+	input_(ComponentMan::instance().intern(input)),
 	inputIndex_(inputIndex),
 	inputSignature_(inputSignature),
 	inputLabels_(),
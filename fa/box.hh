@@ -34,6 +34,7 @@
 #include "treeaut_label.hh"
 #include "abstractbox.hh"
 #include "connection_graph.hh"
+#include "componentman.hh"
 
 
 class TypeBox : public AbstractBox
@@ -355,12 +356,13 @@ public:
 
 	static bool equal(const TreeAut& a, const TreeAut& b)
 	{
-		return TreeAut::subseteq(a, b) && TreeAut::subseteq(b, a);
+		return ComponentMan::instance().subseteq(a, b)
+			&& ComponentMan::instance().subseteq(b, a);
 	}
 
 	static bool lessOrEqual(const TreeAut& a, const TreeAut& b)
 	{
-		return TreeAut::subseteq(a, b);
+		return ComponentMan::instance().subseteq(a, b);
 	}
 
 	size_t getSelector(size_t input) const
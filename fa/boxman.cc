@@ -22,6 +22,8 @@
 #include "streams.hh"
 #include "restart_request.hh"
 
+size_t BoxMan::nextGeneration_ = 0;
+
 namespace
 {	// anonymous namespace
 
@@ -411,7 +413,7 @@ Box* BoxMan::createType2Box(
 }
 
 
-const Box* BoxMan::getBox(const Box& box)
+const Box* BoxMan::storeBox(const Box& box)
 {
 	// insert the box into the manager
 	const Box* cpBox = boxes_.get(box);
@@ -428,10 +430,21 @@ const Box* BoxMan::getBox(const Box& box)
 		FA_DEBUG_AT(1, "learning " << *static_cast<const AbstractBox*>(cpBox)
 			<< ':' << std::endl << *cpBox);
 
+		generation_ = ++nextGeneration_;
+	}
+
+	return cpBox;
+}
+
+
+const Box* BoxMan::getBox(const Box& box)
+{
+	const Box* cpBox = this->storeBox(box);
+
 #if FA_RESTART_AFTER_BOX_DISCOVERY
+	if (boxes_.modified())
 		throw RestartRequest("a new box encountered");
 #endif
-	}
 
 	return cpBox;
 }
@@ -447,4 +460,5 @@ void BoxMan::clear()
 	utils::eraseMap(selIndex_);
 	utils::eraseMap(typeIndex_);
 	boxes_.clear();
+	generation_ = ++nextGeneration_;
 }
@@ -21,6 +21,7 @@
 #define BOX_MANAGER_H
 
 // Standard library headers
+#include <iosfwd>
 #include <vector>
 #include <string>
 #include <unordered_map>
@@ -291,6 +292,12 @@ private:  // data members
 
 	TTypeDescDict typeDescDict_;
 
+	/// The generation of the database of boxes
+	size_t generation_;
+
+	/// The next generation (unique among all instances of BoxMan)
+	static size_t nextGeneration_;
+
 private:  // methods
 
 	const std::pair<const Data, NodeLabel*>& insertData(const Data& data);
@@ -306,6 +313,20 @@ private:  // methods
 	std::string getBoxName() const;
 
 
+	/**
+	 * @brief  Stores a box into the database
+	 *
+	 * This method inserts @p box into the database unless it is already
+	 * present there, in which case the box from the database is returned.
+	 * A newly inserted box is named and initialized.
+	 *
+	 * @param[in]  box  The box to be stored in the database
+	 *
+	 * @returns  Unique pointer to the box
+	 */
+	const Box* storeBox(const Box& box);
+
+
 public:
 
 	label_type lookupLabel(const Data& data)
@@ -332,6 +353,31 @@ public:
 		return &itBoolPair.first->second;
 	}
 
+	/**
+	 * @brief  Checks whether selectors can describe the nodes of a type
+	 *
+	 * The offsets of @p sels have to be those of the type and @p sels have to
+	 * match the description of the type that is already known, if any.
+	 * LookupTypeDesc() may then be called safely.
+	 */
+	bool isTypeDescCompatible(
+		const TypeBox* tb,
+		const std::vector<SelData>& sels) const
+	{
+		const std::vector<size_t>& offsets = tb->getSelectors();
+		if (offsets.size() != sels.size())
+			return false;
+
+		for (size_t i = 0; i < sels.size(); ++i)
+		{
+			if (offsets[i] != sels[i].offset)
+				return false;
+		}
+
+		auto iter = typeDescDict_.find(tb);
+		return (typeDescDict_.end() == iter) || (iter->second == sels);
+	}
+
 	struct EvaluateBoxF
 	{
 		NodeLabel& label;
@@ -462,7 +508,8 @@ public:
 		selIndex_{},
 		typeIndex_{},
 		boxes_{},
-		typeDescDict_{}
+		typeDescDict_{},
+		generation_(++nextGeneration_)
 	{ }
 
 	~BoxMan()
@@ -476,6 +523,50 @@ public:
 	{
 		return boxes_;
 	}
+
+	/**
+	 * @brief  The generation of the database of boxes
+	 *
+	 * The generation changes whenever a box is learned or the database is
+	 * cleared, hence the results of box lookups remain valid as long as the
+	 * generation stays the same.
+	 */
+	size_t generation() const
+	{
+		return generation_;
+	}
+
+
+	/**
+	 * @brief  Exports the database of boxes
+	 *
+	 * This method writes the boxes of the database into @p os in a textual
+	 * format that does not depend on the run, so that BoxMan::importBoxes()
+	 * can read them in another run of the same (or a similar) program.  Boxes
+	 * that contain native pointers are left out.
+	 *
+	 * @param[out]  os  The stream to write the boxes into
+	 *
+	 * @returns  The number of boxes written
+	 */
+	size_t exportBoxes(std::ostream& os) const;
+
+
+	/**
+	 * @brief  Imports boxes exported by BoxMan::exportBoxes()
+	 *
+	 * This method reads boxes from @p is and inserts them into the database
+	 * without requesting a restart.  Boxes that refer to types unknown in this
+	 * program are skipped.  The types need to be loaded already.
+	 *
+	 * @param[in]  is       The stream to read the boxes from
+	 * @param[in]  backend  The backend for the tree automata of the boxes
+	 *
+	 * @returns  The number of boxes imported
+	 *
+	 * @throws  std::runtime_error  if the stream is not a valid database
+	 */
+	size_t importBoxes(std::istream& is, TreeAut::Backend& backend);
 };
 
 #endif
@@ -0,0 +1,723 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file boxman_db.cc
+ *
+ * Export and import of the database of boxes, see BoxMan::exportBoxes().
+ *
+ * The format is a sequence of whitespace-separated tokens:
+ *
+ *   file      := "forester-boxes" VERSION box* "end"
+ *   box       := "box" NAME ta signature input map selectors
+ *   input     := "input" ("-" | INDEX ta signature)
+ *   map       := "map" N INDEX*
+ *   selectors := "selectors" N (FWD BWD)*
+ *   ta        := "ta" N state* N (label state N state*)*
+ *   state     := "q" NUM | "r" data
+ *   label     := "node" N item* (N seldata* | "-") | "data" data
+ *   item      := "sel" seldata | "type" string | "box" string
+ *   seldata   := OFFSET SIZE DISPL string
+ *   data      := TYPE SIZE value
+ *   signature := N (ROOT REFS SELS INHERITED BWD N FWD* N DEF*)*
+ *   string    := LENGTH ":" CHARS
+ *
+ * Boxes are written after all boxes they use, so that each box can be built
+ * as soon as it is read.  Names of boxes are only local to the file.
+ */
+
+
+// Standard library headers
+#include <istream>
+#include <ostream>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+// Forester headers
+#include "boxman.hh"
+#include "streams.hh"
+
+// anonymous namespace
+namespace
+{
+/// version of the format, to be bumped on any incompatible change
+const int DB_VERSION = 1;
+
+/**
+ * @brief  Error signalling an entity that cannot be exported
+ */
+class UnsupportedError : public std::runtime_error
+{
+public:   // methods
+
+	UnsupportedError(const std::string& what) :
+		std::runtime_error(what)
+	{ }
+};
+
+/**
+ * @brief  Writes a box into a stream
+ */
+class BoxWriter
+{
+private:  // data members
+
+	std::ostream& os_;
+
+	const BoxMan& boxMan_;
+
+public:   // methods
+
+	BoxWriter(std::ostream& os, const BoxMan& boxMan) :
+		os_(os),
+		boxMan_(boxMan)
+	{ }
+
+	void writeString(const std::string& str)
+	{
+		os_ << ' ' << str.size() << ':' << str;
+	}
+
+	void writeData(const Data& data)
+	{
+		os_ << ' ' << static_cast<int>(data.type) << ' ' << data.size;
+
+		switch (data.type)
+		{
+			case data_type_e::t_undef:
+			case data_type_e::t_unknw:
+				break;
+
+			case data_type_e::t_void_ptr:
+				os_ << ' ' << data.d_void_ptr_size; break;
+
+			case data_type_e::t_ref:
+				os_ << ' ' << data.d_ref.root << ' ' << data.d_ref.displ; break;
+
+			case data_type_e::t_int:
+				os_ << ' ' << data.d_int; break;
+
+			case data_type_e::t_bool:
+				os_ << ' ' << data.d_bool; break;
+
+			case data_type_e::t_struct:
+				os_ << ' ' << data.d_struct->size();
+				for (const Data::item_info& item : *data.d_struct)
+				{
+					os_ << ' ' << item.first;
+					this->writeData(item.second);
+				}
+				break;
+
+			default:
+				// native pointers are not valid across runs
+				throw UnsupportedError("unsupported data");
+		}
+	}
+
+	void writeSelData(const SelData& sel)
+	{
+		os_ << ' ' << sel.offset << ' ' << sel.size << ' ' << sel.displ;
+		this->writeString(sel.name);
+	}
+
+	void writeLabel(const label_type& label)
+	{
+		const Data* data;
+		if (label->isData(data))
+		{
+			os_ << " data";
+			this->writeData(*data);
+			return;
+		}
+
+		if (!label->isNode())
+			throw UnsupportedError("unsupported label");
+
+		os_ << " node " << label->getNode().size();
+		for (const AbstractBox* aBox : label->getNode())
+		{
+			switch (aBox->getType())
+			{
+				case box_type_e::bSel:
+					os_ << " sel";
+					this->writeSelData(static_cast<const SelBox*>(aBox)->getData());
+					break;
+
+				case box_type_e::bTypeInfo:
+					os_ << " type";
+					this->writeString(static_cast<const TypeBox*>(aBox)->getName());
+					break;
+
+				case box_type_e::bBox:
+					os_ << " box";
+					this->writeString(static_cast<const Box*>(aBox)->getName());
+					break;
+			}
+		}
+
+		const std::vector<SelData>* sels = label->node.sels;
+		if (nullptr == sels)
+		{
+			os_ << " -";
+			return;
+		}
+
+		os_ << ' ' << sels->size();
+		for (const SelData& sel : *sels)
+			this->writeSelData(sel);
+	}
+
+	void writeState(size_t state)
+	{
+		if (!_MSB_TEST(state))
+		{
+			os_ << " q " << state;
+			return;
+		}
+
+		// the identifiers of data are not stable across runs
+		os_ << " r";
+		this->writeData(boxMan_.getData(_MSB_GET(state)));
+	}
+
+	void writeTA(const TreeAut& ta)
+	{
+		os_ << " ta " << ta.getFinalStates().size();
+		for (size_t state : ta.getFinalStates())
+			this->writeState(state);
+
+		size_t count = 0;
+		for (auto iter = ta.begin(); iter != ta.end(); ++iter)
+			++count;
+
+		os_ << ' ' << count;
+		for (const TreeAut::Transition& tr : ta)
+		{
+			os_ << '\n';
+			this->writeLabel(tr.label());
+			this->writeState(tr.rhs());
+			os_ << ' ' << tr.lhs().size();
+			for (size_t state : tr.lhs())
+				this->writeState(state);
+		}
+	}
+
+	void writeSignature(const ConnectionGraph::CutpointSignature& signature)
+	{
+		os_ << '\n' << signature.size();
+		for (const ConnectionGraph::CutpointInfo& cutpoint : signature)
+		{
+			os_ << ' ' << cutpoint.root << ' ' << cutpoint.refCount << ' '
+				<< cutpoint.selCount << ' ' << cutpoint.refInherited << ' '
+				<< cutpoint.bwdSelector;
+
+			os_ << ' ' << cutpoint.fwdSelectors.size();
+			for (size_t sel : cutpoint.fwdSelectors)
+				os_ << ' ' << sel;
+
+			os_ << ' ' << cutpoint.defines.size();
+			for (size_t sel : cutpoint.defines)
+				os_ << ' ' << sel;
+		}
+	}
+};
+
+/**
+ * @brief  Reads boxes from a stream
+ *
+ * A box that refers to an unknown type or box is read but not built.
+ */
+class BoxReader
+{
+private:  // data members
+
+	std::istream& is_;
+
+	BoxMan& boxMan_;
+
+	TreeAut::Backend& backend_;
+
+	/// the boxes built so far, by their names in the stream
+	std::unordered_map<std::string, const Box*> boxes_;
+
+	/// can the box being read be built?
+	bool valid_;
+
+public:   // methods
+
+	BoxReader(
+		std::istream&         is,
+		BoxMan&               boxMan,
+		TreeAut::Backend&     backend) :
+		is_(is),
+		boxMan_(boxMan),
+		backend_(backend),
+		boxes_{},
+		valid_{}
+	{ }
+
+	template <class T>
+	T read()
+	{
+		T val;
+		if (!(is_ >> val))
+			throw std::runtime_error("malformed box database");
+
+		return val;
+	}
+
+	/**
+	 * @brief  Reads a number, or the given placeholder instead of it
+	 *
+	 * @returns  @p false if the placeholder has been read
+	 */
+	bool readOptional(size_t& val, const std::string& placeholder)
+	{
+		const std::string token = this->read<std::string>();
+		if (placeholder == token)
+			return false;
+
+		std::istringstream is(token);
+		char rest;
+		if (!(is >> val) || (is >> rest))
+			throw std::runtime_error("malformed box database");
+
+		return true;
+	}
+
+	void expect(const std::string& token)
+	{
+		if (this->read<std::string>() != token)
+			throw std::runtime_error("malformed box database, expected "
+				+ token);
+	}
+
+	std::string readString()
+	{
+		const size_t len = this->read<size_t>();
+		if (':' != this->read<char>())
+			throw std::runtime_error("malformed box database");
+
+		std::string str(len, '\0');
+		if (len && !is_.read(&str[0], len))
+			throw std::runtime_error("malformed box database");
+
+		return str;
+	}
+
+	Data readData()
+	{
+		Data data(static_cast<data_type_e>(this->read<int>()));
+		data.size = this->read<int>();
+
+		switch (data.type)
+		{
+			case data_type_e::t_undef:
+			case data_type_e::t_unknw:
+				break;
+
+			case data_type_e::t_void_ptr:
+				data.d_void_ptr_size = this->read<size_t>(); break;
+
+			case data_type_e::t_ref:
+				data.d_ref.root = this->read<size_t>();
+				data.d_ref.displ = this->read<int>();
+				break;
+
+			case data_type_e::t_int:
+				data.d_int = this->read<int>(); break;
+
+			case data_type_e::t_bool:
+				data.d_bool = this->read<bool>(); break;
+
+			case data_type_e::t_struct:
+			{
+				std::vector<Data::item_info> items;
+				for (size_t i = this->read<size_t>(); i; --i)
+				{
+					const size_t offset = this->read<size_t>();
+					items.push_back(std::make_pair(offset, this->readData()));
+				}
+
+				const int size = data.size;
+				data = Data::createStruct(items);
+				data.size = size;
+				break;
+			}
+
+			default:
+				throw std::runtime_error("malformed box database");
+		}
+
+		return data;
+	}
+
+	SelData readSelData()
+	{
+		const size_t offset = this->read<size_t>();
+		const int size = this->read<int>();
+		const int displ = this->read<int>();
+		return SelData(offset, size, displ, this->readString());
+	}
+
+	const AbstractBox* readItem()
+	{
+		const std::string kind = this->read<std::string>();
+		if ("sel" == kind)
+			return boxMan_.getSelector(this->readSelData());
+
+		const std::string name = this->readString();
+		if ("type" == kind)
+		{
+			try
+			{
+				return boxMan_.getTypeInfo(name);
+			}
+			catch (const std::runtime_error&)
+			{	// the type is not known in this program
+				valid_ = false;
+				return nullptr;
+			}
+		}
+
+		if ("box" != kind)
+			throw std::runtime_error("malformed box database");
+
+		auto iter = boxes_.find(name);
+		if (boxes_.end() == iter)
+		{	// the box has not been built
+			valid_ = false;
+			return nullptr;
+		}
+
+		return iter->second;
+	}
+
+	label_type readLabel()
+	{
+		const std::string kind = this->read<std::string>();
+		if ("data" == kind)
+			return boxMan_.lookupLabel(this->readData());
+
+		if ("node" != kind)
+			throw std::runtime_error("malformed box database");
+
+		std::vector<const AbstractBox*> items;
+		for (size_t i = this->read<size_t>(); i; --i)
+			items.push_back(this->readItem());
+
+		const std::vector<SelData>* sels = nullptr;
+		size_t count = 0;
+		if (this->readOptional(count, "-"))
+		{
+			std::vector<SelData> v;
+			for (size_t i = count; i; --i)
+				v.push_back(this->readSelData());
+
+			const AbstractBox* type = nullptr;
+			for (const AbstractBox* aBox : items)
+			{
+				if (aBox && aBox->isType(box_type_e::bTypeInfo))
+					type = aBox;
+			}
+
+			if (nullptr == type || !boxMan_.isTypeDescCompatible(
+				static_cast<const TypeBox*>(type), v))
+			{	// the layout of the type has changed since the export
+				valid_ = false;
+			}
+
+			if (valid_)
+				sels = boxMan_.LookupTypeDesc(static_cast<const TypeBox*>(type), v);
+		}
+
+		if (!valid_)
+			return label_type();
+
+		return boxMan_.lookupLabel(items, sels);
+	}
+
+	size_t readState()
+	{
+		const std::string kind = this->read<std::string>();
+		if ("q" == kind)
+			return this->read<size_t>();
+
+		if ("r" != kind)
+			throw std::runtime_error("malformed box database");
+
+		const Data data = this->readData();
+		if (!valid_)
+			return 0;
+
+		return _MSB_ADD(boxMan_.getDataId(data));
+	}
+
+	std::shared_ptr<TreeAut> readTA()
+	{
+		this->expect("ta");
+
+		std::shared_ptr<TreeAut> ta(new TreeAut(backend_));
+
+		for (size_t i = this->read<size_t>(); i; --i)
+			ta->addFinalState(this->readState());
+
+		for (size_t i = this->read<size_t>(); i; --i)
+		{
+			const label_type label = this->readLabel();
+			const size_t rhs = this->readState();
+
+			std::vector<size_t> lhs;
+			for (size_t j = this->read<size_t>(); j; --j)
+				lhs.push_back(this->readState());
+
+			if (valid_)
+				ta->addTransition(lhs, label, rhs);
+		}
+
+		return ta;
+	}
+
+	void readSignature(ConnectionGraph::CutpointSignature& signature)
+	{
+		for (size_t i = this->read<size_t>(); i; --i)
+		{
+			ConnectionGraph::CutpointInfo cutpoint(this->read<size_t>());
+			cutpoint.refCount = this->read<size_t>();
+			cutpoint.selCount = this->read<size_t>();
+			cutpoint.refInherited = this->read<bool>();
+			cutpoint.bwdSelector = this->read<size_t>();
+
+			cutpoint.fwdSelectors.clear();
+			for (size_t j = this->read<size_t>(); j; --j)
+				cutpoint.fwdSelectors.insert(this->read<size_t>());
+
+			for (size_t j = this->read<size_t>(); j; --j)
+				cutpoint.defines.insert(this->read<size_t>());
+
+			signature.push_back(cutpoint);
+		}
+	}
+
+	/**
+	 * @brief  Reads a box and builds it if possible
+	 *
+	 * @param[out]  box  The box built, @p nullptr if it cannot be built
+	 *
+	 * @returns  The name of the box in the stream
+	 */
+	std::string readBox(std::unique_ptr<Box>& box)
+	{
+		valid_ = true;
+
+		const std::string name = this->readString();
+
+		std::shared_ptr<TreeAut> output = this->readTA();
+		ConnectionGraph::CutpointSignature outputSignature;
+		this->readSignature(outputSignature);
+
+		this->expect("input");
+		std::shared_ptr<TreeAut> input;
+		size_t inputIndex = 0;
+		ConnectionGraph::CutpointSignature inputSignature;
+		if (this->readOptional(inputIndex, "-"))
+		{
+			input = this->readTA();
+			this->readSignature(inputSignature);
+		}
+
+		this->expect("map");
+		std::vector<size_t> inputMap;
+		for (size_t i = this->read<size_t>(); i; --i)
+			inputMap.push_back(this->read<size_t>());
+
+		this->expect("selectors");
+		std::vector<std::pair<size_t, size_t>> selectors;
+		for (size_t i = this->read<size_t>(); i; --i)
+		{
+			const size_t fwd = this->read<size_t>();
+			selectors.push_back(std::make_pair(fwd, this->read<size_t>()));
+		}
+
+		if (valid_ && !output->getFinalStates().empty())
+		{
+			box.reset(new Box("", output, outputSignature, inputMap, input,
+				inputIndex, inputSignature, selectors));
+		}
+
+		return name;
+	}
+
+	void addBox(const std::string& name, const Box* box)
+	{
+		boxes_[name] = box;
+	}
+};
+
+/**
+ * @brief  Collects the boxes used in the labels of a tree automaton
+ */
+void collectNestedBoxes(std::vector<const Box*>& boxes, const TreeAut* ta)
+{
+	if (nullptr == ta)
+		return;
+
+	for (const TreeAut::Transition& tr : *ta)
+	{
+		if (!tr.label()->isNode())
+			continue;
+
+		for (const AbstractBox* aBox : tr.label()->getNode())
+		{
+			if (aBox->isBox())
+				boxes.push_back(static_cast<const Box*>(aBox));
+		}
+	}
+}
+
+/**
+ * @brief  Orders the boxes so that each box comes after the boxes it uses
+ */
+void orderBoxes(
+	std::vector<const Box*>&             order,
+	std::set<const Box*>&                visited,
+	const Box*                           box)
+{
+	if (!visited.insert(box).second)
+		return;
+
+	std::vector<const Box*> nested;
+	collectNestedBoxes(nested, box->getOutput());
+	collectNestedBoxes(nested, box->getInput());
+
+	for (const Box* nestedBox : nested)
+		orderBoxes(order, visited, nestedBox);
+
+	order.push_back(box);
+}
+
+} // namespace
+
+
+size_t BoxMan::exportBoxes(std::ostream& os) const
+{
+	std::vector<const Box*> boxes;
+	boxes_.asVector(boxes);
+
+	std::vector<const Box*> order;
+	std::set<const Box*> visited;
+	for (const Box* box : boxes)
+		orderBoxes(order, visited, box);
+
+	os << "forester-boxes " << DB_VERSION << '\n';
+
+	size_t count = 0;
+	std::set<std::string> skipped;
+	for (const Box* box : order)
+	{
+		std::ostringstream buf;
+		BoxWriter writer(buf, *this);
+
+		try
+		{
+			// a box using a box that cannot be exported cannot be exported either
+			std::vector<const Box*> nested;
+			collectNestedBoxes(nested, box->getOutput());
+			collectNestedBoxes(nested, box->getInput());
+			for (const Box* nestedBox : nested)
+			{
+				if (skipped.count(nestedBox->getName()))
+					throw UnsupportedError("unsupported nested box");
+			}
+
+			buf << "box";
+			writer.writeString(box->getName());
+			writer.writeTA(*box->output_);
+			writer.writeSignature(box->outputSignature_);
+
+			buf << "\ninput ";
+			if (box->input_)
+			{
+				buf << box->inputIndex_;
+				writer.writeTA(*box->input_);
+				writer.writeSignature(box->inputSignature_);
+			}
+			else
+			{
+				buf << '-';
+			}
+
+			buf << "\nmap " << box->inputMap_.size();
+			for (size_t index : box->inputMap_)
+				buf << ' ' << index;
+
+			buf << "\nselectors " << box->selectors_.size();
+			for (const std::pair<size_t, size_t>& sel : box->selectors_)
+				buf << ' ' << sel.first << ' ' << sel.second;
+		}
+		catch (const UnsupportedError& e)
+		{
+			FA_DEBUG_AT(1, "not exporting " << box->getName() << ": " << e.what());
+			skipped.insert(box->getName());
+			continue;
+		}
+
+		os << buf.str() << '\n';
+		++count;
+	}
+
+	os << "end" << std::endl;
+
+	return count;
+}
+
+
+size_t BoxMan::importBoxes(std::istream& is, TreeAut::Backend& backend)
+{
+	BoxReader reader(is, *this, backend);
+
+	reader.expect("forester-boxes");
+	if (DB_VERSION != reader.read<int>())
+		throw std::runtime_error("incompatible version of the box database");
+
+	size_t count = 0;
+	for (std::string token; "end" != (token = reader.read<std::string>()); )
+	{
+		if ("box" != token)
+			throw std::runtime_error("malformed box database");
+
+		std::unique_ptr<Box> box;
+		const std::string name = reader.readBox(box);
+		if (!box)
+		{
+			FA_DEBUG_AT(1, "not importing " << name);
+			continue;
+		}
+
+		reader.addBox(name, this->storeBox(*box));
+		++count;
+	}
+
+	return count;
+}
@@ -120,7 +120,7 @@ protected:
 
 	template <class F>
 	void internalInvalidate(const T& x, const T& y, F f) {
-		typename store_type::iterator i = this->store.find(make_pair(x, y));
+		typename store_type::iterator i = this->store.find(std::make_pair(x, y));
 		if (i == this->store.end())
 			return;
 		this->storeMap.find(x)->second.erase(&*i);
@@ -145,7 +145,7 @@ protected:
 	template <class F>
 	typename store_type::value_type* internalLookup(const T& x, const T& y, F f) {
 		assert(x != y);
-		std::pair<typename store_type::iterator, bool> i = this->store.insert(std::make_pair(make_pair(x, y), V()));
+		std::pair<typename store_type::iterator, bool> i = this->store.insert(std::make_pair(std::make_pair(x, y), V()));
 		if (i.second) {
 			f(x, y, &*i.first);
 			this->storeMap.insert(std::make_pair(x, std::set<typename store_type::value_type*>())).first->second.insert(&*i.first);
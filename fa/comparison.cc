@@ -20,6 +20,7 @@
 // Forester headers
 #include "comparison.hh"
 #include "executionmanager.hh"
+#include "microcode.hh"
 #include "streams.hh"
 
 // anonymous namespace
@@ -80,44 +81,76 @@ inline void dataCmp(
 	}
 }
 
-template <class F>
-inline void executeGeneric(
-	const FI_cmp_base&        cmp,
-	ExecutionManager&         execMan,
-	SymState&                 state,
-	F                         f)
+void FI_cmp_base::execute(ExecutionManager& execMan, SymState& state)
 {
 	std::vector<bool> res;
 
-	dataCmp(res, state.GetReg(cmp.src1_), state.GetReg(cmp.src2_), f);
+	this->compare(res, state);
 
 	for (auto v : res)
 	{
-		SymState* tmpState = execMan.createChildStateWithNewRegs(state, cmp.next_);
-		tmpState->SetReg(cmp.dstReg_, Data::createBool(v));
+		SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
+		tmpState->SetReg(dstReg_, Data::createBool(v));
 
 		execMan.enqueue(tmpState);
 	}
 }
 
-void FI_eq::execute(ExecutionManager& execMan, SymState& state)
+void FI_eq::compare(std::vector<bool>& res, const SymState& state) const
 {
-	executeGeneric(*this, execMan, state,
+	dataCmp(res, state.GetReg(src1_), state.GetReg(src2_),
 		[](const Data& x, const Data& y){return x == y;});
 }
 
-void FI_neq::execute(ExecutionManager& execMan, SymState& state)
+void FI_neq::compare(std::vector<bool>& res, const SymState& state) const
 {
-	executeGeneric(*this, execMan, state,
+	dataCmp(res, state.GetReg(src1_), state.GetReg(src2_),
 		[](const Data& x, const Data& y){return x != y;});
 }
 
-void FI_lt::execute(ExecutionManager& execMan, SymState& state)
+void FI_lt::compare(std::vector<bool>& res, const SymState& state) const
+{
+	dataCmp(res, state.GetReg(src1_), state.GetReg(src2_), Lt());
+}
+
+void FI_gt::compare(std::vector<bool>& res, const SymState& state) const
 {
-	executeGeneric(*this, execMan, state, Lt());
+	dataCmp(res, state.GetReg(src1_), state.GetReg(src2_), Gt());
+}
+
+FI_cmp_cond::FI_cmp_cond(FI_cmp_base* cmp, FI_cond* cond) :
+	RegisterAssignment(cmp->insn(), cmp->dstReg(), fi_type_e::fiBranch),
+	cmp_(cmp),
+	cond_(cond),
+	branch_{cond->branch(0), cond->branch(1)}
+{
+	// Assertions
+	assert(cond->src() == cmp->dstReg());
+}
+
+FI_cmp_cond::~FI_cmp_cond()
+{
+	delete cmp_;
+	delete cond_;
+}
+
+void FI_cmp_cond::execute(ExecutionManager& execMan, SymState& state)
+{
+	std::vector<bool> res;
+
+	cmp_->compare(res, state);
+
+	for (auto v : res)
+	{
+		SymState* tmpState = execMan.createChildStateWithNewRegs(state,
+			branch_[(v)?(0):(1)]);
+		tmpState->SetReg(dstReg_, Data::createBool(v));
+
+		execMan.enqueue(tmpState);
+	}
 }
 
-void FI_gt::execute(ExecutionManager& execMan, SymState& state)
+std::ostream& FI_cmp_cond::toStream(std::ostream& os) const
 {
-	executeGeneric(*this, execMan, state, Gt());
+	return os << *cmp_ << "; " << *cond_;
 }
@@ -23,6 +23,8 @@
 // Forester headers
 #include "sequentialinstruction.hh"
 
+class FI_cond;
+
 /**
  * @brief  The base class for comparison instructions
  *
@@ -32,13 +34,6 @@
  */
 class FI_cmp_base : public RegisterAssignment
 {
-	template <class F>
-	friend void executeGeneric(
-		const FI_cmp_base&        cmp,
-		ExecutionManager&         execMan,
-		SymState&                 state,
-		F                         f);
-
 protected:
 
 	/// Index of the register with the left-hand side operand
@@ -58,6 +53,17 @@ public:
 		src1_(src1),
 		src2_(src2)
 	{ }
+
+	virtual void execute(ExecutionManager& execMan, SymState& state);
+
+	/**
+	 * @brief  Evaluates the comparison
+	 *
+	 * @param[out]  res    The possible results of the comparison (two of them in
+	 *                     case the precise result is not known)
+	 * @param[in]   state  The state in which the comparison is evaluated
+	 */
+	virtual void compare(std::vector<bool>& res, const SymState& state) const = 0;
 };
 
 /**
@@ -77,7 +83,7 @@ public:
 		FI_cmp_base(insn, dst, src1, src2)
 	{ }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void compare(std::vector<bool>& res, const SymState& state) const;
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "eq    \tr" << this->dstReg_ << ", r" << this->src1_ << ", r"
@@ -102,7 +108,7 @@ public:
 		FI_cmp_base(insn, dst, src1, src2)
 	{ }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void compare(std::vector<bool>& res, const SymState& state) const;
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "neq   \tr" << this->dstReg_ << ", r" << this->src1_ << ", r"
@@ -128,7 +134,7 @@ public:
 		FI_cmp_base(insn, dst, src1, src2)
 	{ }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void compare(std::vector<bool>& res, const SymState& state) const;
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "lt    \tr" << this->dstReg_ << ", r" << this->src1_ << ", r"
@@ -153,7 +159,7 @@ public:
 		FI_cmp_base(insn, dst, src1, src2)
 	{ }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void compare(std::vector<bool>& res, const SymState& state) const;
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "gt    \tr" << this->dstReg_ << ", r" << this->src1_ << ", r"
@@ -161,4 +167,45 @@ public:
 	}
 };
 
+/**
+ * @brief  Comparison fused with a conditional jump
+ *
+ * Super-instruction created by the optimiser of the microcode from
+ * a comparison that is immediately followed by a conditional jump on its
+ * result. The result is still stored into the destination register, but the
+ * state continues directly with the corresponding branch.
+ */
+class FI_cmp_cond : public RegisterAssignment
+{
+	/// The comparison (owned by this instruction)
+	FI_cmp_base* cmp_;
+
+	/// The conditional jump (owned by this instruction)
+	FI_cond* cond_;
+
+	/// pointers to @p if and @p else blocks (in this order)
+	AbstractInstruction* branch_[2];
+
+private:  // methods
+
+	FI_cmp_cond(const FI_cmp_cond&);
+	FI_cmp_cond& operator=(const FI_cmp_cond&);
+
+public:
+
+	FI_cmp_cond(FI_cmp_base* cmp, FI_cond* cond);
+
+	virtual ~FI_cmp_cond();
+
+	virtual void execute(ExecutionManager& execMan, SymState& state);
+
+	virtual std::ostream& toStream(std::ostream& os) const;
+
+	virtual void successors(std::vector<const AbstractInstruction*>& dst) const
+	{
+		dst.push_back(branch_[0]);
+		dst.push_back(branch_[1]);
+	}
+};
+
 #endif
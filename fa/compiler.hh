@@ -330,6 +330,18 @@ public:
 	void compile(Assembly& assembly, const CodeStorage::Storage &stor,
 		const CodeStorage::Fnc& entry);
 
+	/**
+	 * @brief  Optimises the compiled code
+	 *
+	 * Drops redundant checks of garbage and dead register assignments, fuses
+	 * sequences of pure register assignments and comparisons followed by
+	 * conditional jumps into super-instructions. Each executed instruction
+	 * costs a new symbolic state, so fewer instructions mean fewer states.
+	 *
+	 * @param[in,out]  assembly  The finalised assembly code to be optimised
+	 */
+	static void optimize(Assembly& assembly);
+
 private:
 
 	/**
@@ -0,0 +1,295 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file compiler_opt.cc
+ *
+ * Optimiser of the finalised microcode, see Compiler::optimize().
+ */
+
+
+// Standard library headers
+#include <algorithm>
+
+// Forester headers
+#include "comparison.hh"
+#include "compiler.hh"
+#include "microcode.hh"
+#include "streams.hh"
+
+// anonymous namespace
+namespace
+{
+typedef Compiler::Assembly::CodeList CodeList;
+
+/**
+ * @brief  Checks whether an instruction falls through to another one
+ *
+ * @returns  @p pred if it is a sequential instruction followed by @p instr,
+ *           @p nullptr otherwise
+ */
+SequentialInstruction* fallsThrough(
+	AbstractInstruction*                  pred,
+	const AbstractInstruction*            instr)
+{
+	SequentialInstruction* seq = dynamic_cast<SequentialInstruction*>(pred);
+	if (!seq || (seq->next() != instr))
+		return nullptr;
+
+	return seq;
+}
+
+/**
+ * @brief  Gets the instruction that falls through to the given one
+ *
+ * @param[in]  code   The optimised code built so far
+ * @param[in]  instr  The instruction to be appended to @p code
+ *
+ * @returns  The last instruction of @p code if its successor is @p instr,
+ *           @p nullptr otherwise
+ */
+SequentialInstruction* fallThrough(
+	const CodeList&                       code,
+	const AbstractInstruction*            instr)
+{
+	if (code.empty())
+		return nullptr;
+
+	return fallsThrough(code.back(), instr);
+}
+
+/**
+ * @brief  Gets the instruction as a pure register assignment
+ *
+ * @returns  @p instr if it is a pure register assignment, @p nullptr otherwise
+ */
+PureAssignment* asPure(AbstractInstruction* instr)
+{
+	return dynamic_cast<PureAssignment*>(instr);
+}
+
+/**
+ * @brief  Drops the checks already performed on the same heap
+ *
+ * A check of garbage depends only on the heap. Hence, a check that is reached
+ * only through a sequence of pure instructions from another check has no
+ * effect.
+ */
+size_t dropRedundantChecks(CodeList& code)
+{
+	CodeList out;
+	size_t dropped = 0;
+
+	for (AbstractInstruction* instr : code)
+	{
+		SequentialInstruction* pred = fallThrough(out, instr);
+		if (!pred || instr->isTarget() || (fi_type_e::fiCheck != instr->getType()))
+		{
+			out.push_back(instr);
+			continue;
+		}
+
+		// look for the previous check
+		bool redundant = false;
+		for (size_t i = out.size(); i > 0; --i)
+		{
+			AbstractInstruction* prev = out[i - 1];
+			if (fi_type_e::fiCheck == prev->getType())
+			{
+				redundant = true;
+				break;
+			}
+
+			if (!asPure(prev) || prev->isTarget() || (1 == i)
+				|| !fallsThrough(out[i - 2], prev))
+			{	// the heap may differ from the one of the previous check
+				break;
+			}
+		}
+
+		if (!redundant)
+		{
+			out.push_back(instr);
+			continue;
+		}
+
+		pred->next(static_cast<SequentialInstruction*>(instr)->next());
+		delete instr;
+		++dropped;
+	}
+
+	code.swap(out);
+	return dropped;
+}
+
+/**
+ * @brief  Drops assignments whose result is overwritten within the sequence
+ *
+ * @param[in,out]  seq  A sequence of pure instructions executed in this order
+ *
+ * @returns  The number of instructions dropped
+ */
+size_t dropDeadAssignments(std::vector<PureAssignment*>& seq)
+{
+	std::vector<PureAssignment*> out;
+	size_t dropped = 0;
+
+	for (size_t i = 0; i < seq.size(); ++i)
+	{
+		const size_t dst = seq[i]->dstReg();
+
+		bool dead = false;
+		for (size_t j = i + 1; seq[i]->isRemovable() && (j < seq.size()); ++j)
+		{
+			std::vector<size_t> used;
+			seq[j]->usedRegs(used);
+			if (used.end() != std::find(used.begin(), used.end(), dst))
+				break;
+
+			if (seq[j]->dstReg() == dst)
+			{
+				dead = true;
+				break;
+			}
+		}
+
+		if (dead)
+		{
+			delete seq[i];
+			++dropped;
+		}
+		else
+		{
+			out.push_back(seq[i]);
+		}
+	}
+
+	seq.swap(out);
+	return dropped;
+}
+
+/**
+ * @brief  Fuses sequences of pure instructions into super-instructions
+ *
+ * Only the instructions that belong to the same instruction of the code
+ * storage are fused, so that the traces of the program stay the same.
+ */
+size_t fuseAssignments(CodeList& code)
+{
+	CodeList out;
+	size_t dropped = 0;
+
+	for (size_t i = 0; i < code.size(); )
+	{
+		AbstractInstruction* instr = code[i];
+		SequentialInstruction* pred = fallThrough(out, instr);
+		PureAssignment* head = asPure(instr);
+		if (!pred || !head || instr->isTarget())
+		{
+			out.push_back(instr);
+			++i;
+			continue;
+		}
+
+		// collect the longest sequence of pure instructions
+		std::vector<PureAssignment*> seq(1, head);
+		for (++i; i < code.size(); ++i)
+		{
+			PureAssignment* ra = asPure(code[i]);
+			if (!ra || ra->isTarget() || (ra->insn() != head->insn())
+				|| (seq.back()->next() != ra))
+			{
+				break;
+			}
+
+			seq.push_back(ra);
+		}
+
+		AbstractInstruction* next = seq.back()->next();
+
+		dropped += dropDeadAssignments(seq);
+
+		SequentialInstruction* fused = seq.front();
+		if (1 < seq.size())
+		{
+			fused = new FI_assign_seq(seq);
+			dropped += seq.size() - 1;
+		}
+
+		fused->next(next);
+		pred->next(fused);
+		out.push_back(fused);
+	}
+
+	code.swap(out);
+	return dropped;
+}
+
+/**
+ * @brief  Fuses comparisons with the conditional jumps on their results
+ */
+size_t fuseCmpCond(CodeList& code)
+{
+	CodeList out;
+	size_t dropped = 0;
+
+	for (size_t i = 0; i < code.size(); ++i)
+	{
+		AbstractInstruction* instr = code[i];
+		SequentialInstruction* pred = fallThrough(out, instr);
+		FI_cmp_base* cmp = dynamic_cast<FI_cmp_base*>(instr);
+		FI_cond* cond = (i + 1 < code.size())
+			? dynamic_cast<FI_cond*>(code[i + 1])
+			: nullptr;
+
+		if (!pred || !cmp || !cond || instr->isTarget() || cond->isTarget()
+			|| (cmp->next() != cond) || (cond->src() != cmp->dstReg()))
+		{
+			out.push_back(instr);
+			continue;
+		}
+
+		AbstractInstruction* fused = new FI_cmp_cond(cmp, cond);
+		pred->next(fused);
+		out.push_back(fused);
+		++dropped;
+		++i;
+	}
+
+	code.swap(out);
+	return dropped;
+}
+
+} // namespace
+
+
+void Compiler::optimize(Assembly& assembly)
+{
+	const size_t size = assembly.code_.size();
+
+	const size_t checks = dropRedundantChecks(assembly.code_);
+	const size_t assigns = fuseAssignments(assembly.code_);
+	const size_t conds = fuseCmpCond(assembly.code_);
+
+	FA_LOG("microcode optimised: " << size << " -> " << assembly.code_.size()
+		<< " instructions (" << checks << " checks dropped, " << assigns
+		<< " assignments fused or dropped, " << conds
+		<< " conditional jumps fused)");
+}
@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Standard library headers
+#include <algorithm>
+#include <cassert>
+
+// Boost headers
+#include <boost/functional/hash.hpp>
+
+// Forester headers
+#include "componentman.hh"
+#include "forestaut.hh"
+
+ComponentMan* ComponentMan::inst_ = nullptr;
+
+
+void ComponentMan::Unregister::operator()(TreeAut* ptr)
+{
+	this->man->release(ptr);
+
+	// drop the original owner, which may destroy the automaton
+	this->ta.reset();
+}
+
+
+size_t ComponentMan::structuralHash(const TreeAut& ta)
+{
+	size_t hash = boost::hash_value(ta.backend);
+	for (const TreeAut::TransIDPair* trans : ta.transitions)
+		boost::hash_combine(hash, trans);
+
+	for (size_t state : ta.getFinalStates())
+		boost::hash_combine(hash, state);
+
+	return hash;
+}
+
+
+bool ComponentMan::structurallyEqual(const TreeAut& lhs, const TreeAut& rhs)
+{
+	// transitions are shared within a backend, hence comparing pointers is
+	// enough (the sets are ordered by the transitions themselves)
+	return (lhs.backend == rhs.backend)
+		&& (lhs.transitions.size() == rhs.transitions.size())
+		&& std::equal(lhs.transitions.begin(), lhs.transitions.end(),
+			rhs.transitions.begin())
+		&& (lhs.getFinalStates() == rhs.getFinalStates());
+}
+
+
+void ComponentMan::release(const TreeAut* ptr)
+{
+	auto i = entries_.find(ptr);
+	assert(i != entries_.end());
+
+	auto j = buckets_.find(i->second.hash);
+	assert(j != buckets_.end());
+
+	std::vector<const TreeAut*>& bucket = j->second;
+	bucket.erase(std::find(bucket.begin(), bucket.end(), ptr));
+	if (bucket.empty())
+		buckets_.erase(j);
+
+	inclusion_.invalidateKey(i->second.id, [](bool) {});
+	entries_.erase(i);
+}
+
+
+const ComponentMan::Entry* ComponentMan::lookup(const TreeAut& ta) const
+{
+	auto i = entries_.find(&ta);
+	if (i == entries_.end())
+		return nullptr;
+
+	return &i->second;
+}
+
+
+std::shared_ptr<TreeAut> ComponentMan::intern(
+	const std::shared_ptr<TreeAut>&      ta)
+{
+	if (!ta)
+		return ta;
+
+	if (const Entry* entry = this->lookup(*ta))
+	{	// either interned already or the original owner of an interned one
+		std::shared_ptr<TreeAut> res = entry->ta.lock();
+		if (res)
+			return res;
+	}
+
+	const size_t hash = ComponentMan::structuralHash(*ta);
+
+	std::vector<const TreeAut*>& bucket = buckets_[hash];
+	for (const TreeAut* other : bucket)
+	{
+		if (!ComponentMan::structurallyEqual(*ta, *other))
+			continue;
+
+		std::shared_ptr<TreeAut> res = entries_.at(other).ta.lock();
+		if (res)
+			return res;
+	}
+
+	std::shared_ptr<TreeAut> res(ta.get(), Unregister{this, ta});
+
+	entries_.emplace(ta.get(), Entry(res, nextId_++, hash));
+	bucket.push_back(ta.get());
+
+	return res;
+}
+
+
+void ComponentMan::internRoots(FA& fa)
+{
+	for (size_t i = 0; i < fa.getRootCount(); ++i)
+	{
+		if (fa.getRoot(i))
+			fa.replaceRoot(i, this->intern(fa.getRoot(i)));
+	}
+}
+
+
+bool ComponentMan::subseteq(const TreeAut& lhs, const TreeAut& rhs)
+{
+	if (&lhs == &rhs)
+		return true;
+
+	const Entry* lhsEntry = this->lookup(lhs);
+	const Entry* rhsEntry = this->lookup(rhs);
+	if (!lhsEntry || !rhsEntry)
+		return TreeAut::subseteq(lhs, rhs);
+
+	return inclusion_.lookup(lhsEntry->id, rhsEntry->id,
+		[&lhs, &rhs](size_t, size_t) { return TreeAut::subseteq(lhs, rhs); });
+}
+
+
+const ComponentMan::FoldResult* ComponentMan::lookupFold(
+	const TreeAut&                       ta,
+	const FoldKey&                       key) const
+{
+	const Entry* entry = this->lookup(ta);
+	if (!entry)
+		return nullptr;
+
+	for (const std::pair<FoldKey, FoldResult>& fold : entry->folds)
+	{
+		if (fold.first == key)
+			return &fold.second;
+	}
+
+	return nullptr;
+}
+
+
+void ComponentMan::storeFold(
+	const TreeAut&                       ta,
+	const FoldKey&                       key,
+	FoldResult                           result)
+{
+	auto i = entries_.find(&ta);
+	if (i == entries_.end())
+		return;
+
+	std::vector<std::pair<FoldKey, FoldResult>>& folds = i->second.folds;
+	folds.erase(std::remove_if(folds.begin(), folds.end(),
+		[&key](const std::pair<FoldKey, FoldResult>& fold)
+		{ return fold.first.generation != key.generation; }), folds.end());
+
+	folds.push_back(std::make_pair(key, std::move(result)));
+}
@@ -0,0 +1,245 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef COMPONENT_MAN_H
+#define COMPONENT_MAN_H
+
+/**
+ * @file componentman.hh
+ * ComponentMan - table of tree automata components shared among forest
+ * automata
+ */
+
+// Standard library headers
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Forester headers
+#include "cache.hh"
+#include "treeaut_label.hh"
+
+class Box;
+class FA;
+
+/**
+ * @brief  Hash-consing of tree automata components
+ *
+ * The table keeps (weakly) a single instance of each structurally distinct
+ * component of forest automata.  Two tree automata are structurally equal if
+ * they live in the same backend and have the same transitions and the same
+ * final states.  As transitions are already shared in the backend, this is
+ * only a comparison of two sets of pointers.
+ *
+ * An interned component must not be modified.  The results of inclusion
+ * checks on the pairs of interned components are kept in a memo, which is
+ * invalidated once any of the components is released.  Similarly, each
+ * component keeps the outcomes of the attempts to fold a box inside it (see
+ * Folding), which are dropped together with the component.
+ */
+class ComponentMan
+{
+public:   // data types
+
+	/**
+	 * @brief  The parameters of an attempt to fold a box in a component
+	 *
+	 * The cutpoint signatures of the states of a component are determined by
+	 * the component itself, hence they need not be a part of the key.
+	 */
+	struct FoldKey
+	{
+		/// Index of the component in the forest automaton
+		size_t                          root;
+		/// The state under which the box is folded
+		size_t                          state;
+		/// Index of the other component (or cutpoint) of the box
+		size_t                          aux;
+		/// ID of the other component for boxes with two components, or -1
+		size_t                          auxId;
+		/// Whether the box was only looked up in the database
+		bool                            conditional;
+		/// Generation of the database of boxes, see BoxMan::generation()
+		size_t                          generation;
+
+		bool operator==(const FoldKey& rhs) const
+		{
+			return (root == rhs.root) && (state == rhs.state) && (aux == rhs.aux)
+				&& (auxId == rhs.auxId) && (conditional == rhs.conditional)
+				&& (generation == rhs.generation);
+		}
+	};
+
+	/// The outcome of an attempt to fold a box in a component
+	struct FoldResult
+	{
+		/// The box, or @p nullptr if folding is not possible
+		const Box*                      box;
+		/// Indices of the cutpoints referenced by the box
+		std::vector<size_t>             cutpoints;
+	};
+
+private:  // data types
+
+	/// Deleter of interned components, it removes them from the table
+	struct Unregister
+	{
+		ComponentMan*                   man;
+		std::shared_ptr<TreeAut>        ta;
+
+		void operator()(TreeAut* ptr);
+	};
+
+	/// An interned component
+	struct Entry
+	{
+		std::weak_ptr<TreeAut>          ta;
+		size_t                          id;
+		size_t                          hash;
+		std::vector<std::pair<FoldKey, FoldResult>> folds;
+
+		Entry(const std::shared_ptr<TreeAut>& ta, size_t id, size_t hash) :
+			ta(ta),
+			id(id),
+			hash(hash),
+			folds()
+		{ }
+	};
+
+private:  // data members
+
+	static ComponentMan* inst_;
+
+	/// The interned components indexed by their address
+	std::unordered_map<const TreeAut*, Entry> entries_;
+
+	/// The interned components indexed by their structural hash
+	std::unordered_map<size_t, std::vector<const TreeAut*>> buckets_;
+
+	/// The memo of inclusion checks indexed by the IDs of the components
+	CachedBinaryOp<size_t, bool> inclusion_;
+
+	/// The ID of the next interned component (IDs are never reused)
+	size_t nextId_;
+
+private:  // methods
+
+	ComponentMan() :
+		entries_{},
+		buckets_{},
+		inclusion_{},
+		nextId_(0)
+	{ }
+
+	ComponentMan(const ComponentMan&);
+	ComponentMan& operator=(const ComponentMan&);
+
+	static size_t structuralHash(const TreeAut& ta);
+
+	static bool structurallyEqual(const TreeAut& lhs, const TreeAut& rhs);
+
+	void release(const TreeAut* ptr);
+
+	const Entry* lookup(const TreeAut& ta) const;
+
+public:   // methods
+
+	/**
+	 * @brief  Gets the instance of the table
+	 *
+	 * The table is never destroyed, so that components released during the
+	 * destruction of static objects can still unregister.
+	 */
+	static ComponentMan& instance()
+	{
+		return (inst_)? (*inst_) : (*(inst_ = new ComponentMan));
+	}
+
+	/**
+	 * @brief  Interns a tree automaton
+	 *
+	 * @param[in]  ta  The tree automaton to be interned (may be @p nullptr)
+	 *
+	 * @returns  The interned component structurally equal to @p ta, which is
+	 *           @p ta itself if there was no such component so far
+	 */
+	std::shared_ptr<TreeAut> intern(const std::shared_ptr<TreeAut>& ta);
+
+	/**
+	 * @brief  Interns all components of a forest automaton
+	 *
+	 * @param[in,out]  fa  The forest automaton whose roots are to be interned
+	 */
+	void internRoots(FA& fa);
+
+	/**
+	 * @brief  Checks language inclusion of two tree automata
+	 *
+	 * The result is taken from the memo in case both automata are interned.
+	 *
+	 * @returns  @p true if the language of @p lhs is a subset of the language
+	 *           of @p rhs, @p false otherwise
+	 */
+	bool subseteq(const TreeAut& lhs, const TreeAut& rhs);
+
+	/**
+	 * @brief  Gets the ID of an interned component
+	 *
+	 * @returns  The ID of @p ta, or -1 if @p ta is not interned
+	 */
+	size_t id(const TreeAut& ta) const
+	{
+		const Entry* entry = this->lookup(ta);
+		return (entry)? (entry->id) : (static_cast<size_t>(-1));
+	}
+
+	/**
+	 * @brief  Looks up the outcome of an attempt to fold a box
+	 *
+	 * @param[in]  ta   The component in which the box is folded
+	 * @param[in]  key  The parameters of the attempt
+	 *
+	 * @returns  The outcome recorded for @p key, or @p nullptr if there is none
+	 *           (or @p ta is not interned)
+	 */
+	const FoldResult* lookupFold(const TreeAut& ta, const FoldKey& key) const;
+
+	/**
+	 * @brief  Records the outcome of an attempt to fold a box
+	 *
+	 * The outcomes recorded for older generations of the database of boxes are
+	 * dropped.  Nothing is recorded unless @p ta is interned.
+	 *
+	 * @param[in]  ta      The component in which the box is folded
+	 * @param[in]  key     The parameters of the attempt
+	 * @param[in]  result  The outcome of the attempt
+	 */
+	void storeFold(const TreeAut& ta, const FoldKey& key, FoldResult result);
+
+	/**
+	 * @brief  The number of interned components
+	 */
+	size_t size() const
+	{
+		return entries_.size();
+	}
+};
+
+#endif
@@ -61,9 +61,20 @@
 #define FA_FUSION_ENABLED					       1
 
 /**
- * use predicate abstraction (default abstraction is finite height abstraction)
+ * use predicate abstraction (default abstraction is finite height abstraction),
+ * enabled by the FA_PREDICATE_ABSTRACTION option of cmake
  */
-#define FA_USE_PREDICATE_ABSTRACTION     0
+#ifndef FA_USE_PREDICATE_ABSTRACTION
+#	define FA_USE_PREDICATE_ABSTRACTION   0
+#endif
+
+/**
+ * after refining predicate abstraction, invalidate only the fixpoints reachable
+ * from the refined abstraction and resume from the others (default is 1)
+ */
+#ifndef FA_REFINE_FROM_FAILPOINT
+#	define FA_REFINE_FROM_FAILPOINT       1
+#endif
 
 
 #endif /* CONFIG_H */
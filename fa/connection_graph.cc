@@ -42,8 +42,7 @@ void ConnectionGraph::updateStateSignature(
 
 			oldSig[i].refCount = std::max(oldSig[i].refCount, v[i].refCount);
 			oldSig[i].selCount = std::max(oldSig[i].selCount, v[i].selCount);
-			oldSig[i].fwdSelectors.insert(v[i].fwdSelectors.begin(),
-				v[i].fwdSelectors.end());
+			oldSig[i].fwdSelectors.insert(v[i].fwdSelectors);
 		}
 	}
 }
@@ -527,8 +526,7 @@ void ConnectionGraph::normalizeSignature(CutpointSignature& signature)
 				static_cast<size_t>(FA_REF_CNT_TRESHOLD));
 			cutpoint.selCount = cutpoint.selCount + signature[i].selCount;
 			cutpoint.refInherited = false;
-			cutpoint.fwdSelectors.insert(
-					signature[i].fwdSelectors.begin(), signature[i].fwdSelectors.end());
+			cutpoint.fwdSelectors.insert(signature[i].fwdSelectors);
 
 			// fwdSelectors always contains -1 which we need to subtract
 			cutpoint.selCount = cutpoint.fwdSelectors.size() - 1;
@@ -541,8 +539,7 @@ void ConnectionGraph::normalizeSignature(CutpointSignature& signature)
 			assert(
 				ConnectionGraph::areDisjoint(cutpoint.defines, signature[i].defines));
 
-			cutpoint.defines.insert(
-				signature[i].defines.begin(), signature[i].defines.end());
+			cutpoint.defines.insert(signature[i].defines);
 		}
 	}
 
@@ -783,6 +780,31 @@ void ConnectionGraph::updateRoot(
 }
 
 
+bool ConnectionGraph::checkRoot(
+	size_t           root,
+	const TreeAut&   ta) const
+{
+	// Assertions
+	assert(root < this->data.size());
+
+	if (!this->data[root].valid)
+		return true;
+
+	StateToCutpointSignatureMap stateMap;
+
+	ConnectionGraph::computeSignatures(stateMap, ta);
+
+	for (size_t state : ta.getFinalStates())
+	{
+		auto iter = stateMap.find(state);
+		if ((stateMap.end() == iter) || (this->data[root].signature != iter->second))
+			return false;
+	}
+
+	return true;
+}
+
+
 void ConnectionGraph::updateBackwardData(size_t root)
 {
 	// Assertions
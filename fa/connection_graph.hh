@@ -30,6 +30,9 @@
 #include <algorithm>
 #include <memory>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 
 // Forester headers
 #include "types.hh"
@@ -45,6 +48,180 @@
 #define _MSB_ADD(x)   (x | _MSB)
 
 
+/**
+ * @brief  A set of selectors
+ *
+ * The selectors below 64 (i.e. the common offsets of small structures) are
+ * kept in a bit mask, the others (including the -1 sentinel) in a sorted
+ * vector.  The set is iterated in the ascending order like @p std::set.
+ */
+class SelectorSet
+{
+private:  // data members
+
+	/// the selectors below 64
+	uint64_t low_;
+
+	/// the other selectors, sorted
+	std::vector<size_t> high_;
+
+public:   // data types
+
+	class const_iterator
+	{
+	public:   // data types
+
+		typedef std::forward_iterator_tag iterator_category;
+		typedef size_t value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef const size_t* pointer;
+		typedef size_t reference;
+
+	private:  // data members
+
+		const SelectorSet* set_;
+
+		/// index of a bit in @p low_ if below 64, (64 + index) to @p high_ otherwise
+		size_t pos_;
+
+	public:   // methods
+
+		const_iterator(const SelectorSet* set, size_t pos) :
+			set_(set),
+			pos_(pos)
+		{ }
+
+		size_t operator*() const
+		{
+			return (pos_ < 64)? pos_ : set_->high_[pos_ - 64];
+		}
+
+		const_iterator& operator++()
+		{
+			pos_ = (pos_ < 64)? set_->nextLow(pos_ + 1) : (pos_ + 1);
+			return *this;
+		}
+
+		bool operator==(const const_iterator& rhs) const
+		{
+			return (set_ == rhs.set_) && (pos_ == rhs.pos_);
+		}
+
+		bool operator!=(const const_iterator& rhs) const
+		{
+			return !(*this == rhs);
+		}
+	};
+
+private:  // methods
+
+	/// the lowest position of a selector in @p low_ not below @p pos, or 64
+	size_t nextLow(size_t pos) const
+	{
+		const uint64_t rest = (pos < 64)? (low_ >> pos) : 0;
+		return (rest)? (pos + __builtin_ctzll(rest)) : 64;
+	}
+
+public:   // methods
+
+	SelectorSet() :
+		low_(0),
+		high_{}
+	{ }
+
+	void insert(size_t selector)
+	{
+		if (selector < 64)
+		{
+			low_ |= static_cast<uint64_t>(1) << selector;
+			return;
+		}
+
+		auto iter = std::lower_bound(high_.begin(), high_.end(), selector);
+		if ((high_.end() == iter) || (*iter != selector))
+			high_.insert(iter, selector);
+	}
+
+	template <class InputIterator>
+	void insert(InputIterator first, InputIterator last)
+	{
+		for (; first != last; ++first)
+			this->insert(*first);
+	}
+
+	void insert(const SelectorSet& other)
+	{
+		low_ |= other.low_;
+		for (size_t selector : other.high_)
+			this->insert(selector);
+	}
+
+	void clear()
+	{
+		low_ = 0;
+		high_.clear();
+	}
+
+	bool empty() const
+	{
+		return !low_ && high_.empty();
+	}
+
+	size_t size() const
+	{
+		return __builtin_popcountll(low_) + high_.size();
+	}
+
+	const_iterator begin() const
+	{
+		return const_iterator(this, this->nextLow(0));
+	}
+
+	const_iterator end() const
+	{
+		return const_iterator(this, 64 + high_.size());
+	}
+
+	bool isDisjoint(const SelectorSet& other) const
+	{
+		if (low_ & other.low_)
+			return false;
+
+		for (size_t selector : high_)
+		{
+			if (std::binary_search(other.high_.begin(), other.high_.end(), selector))
+				return false;
+		}
+
+		return true;
+	}
+
+	bool includes(const SelectorSet& other) const
+	{
+		return ((low_ & other.low_) == other.low_) && std::includes(
+			high_.begin(), high_.end(), other.high_.begin(), other.high_.end());
+	}
+
+	bool operator==(const SelectorSet& rhs) const
+	{
+		return (low_ == rhs.low_) && (high_ == rhs.high_);
+	}
+
+	bool operator!=(const SelectorSet& rhs) const
+	{
+		return !(*this == rhs);
+	}
+
+	friend size_t hash_value(const SelectorSet& set)
+	{
+		size_t seed = 0;
+		boost::hash_combine(seed, set.low_);
+		boost::hash_combine(seed, set.high_);
+		return seed;
+	}
+};
+
+
 class ConnectionGraph
 {
 private:  // data type
@@ -68,7 +245,7 @@ public:
 		bool refInherited;
 
 		/// a set of selectors which reach the given cutpoint
-		std::set<size_t> fwdSelectors;
+		SelectorSet fwdSelectors;
 
 		/// lowest selector of 'root' from which the state can be reached in the
 		/// opposite direction
@@ -76,7 +253,7 @@ public:
 
 		/// set of selectors of the cutpoint hidden in the subtree (includes
 		/// backwardSelector if exists)
-		std::set<size_t> defines;
+		SelectorSet defines;
 
 		CutpointInfo(size_t root = 0) :
 			root(root),
@@ -262,18 +439,15 @@ public:
 	}
 
 	static bool areDisjoint(
-		const std::set<size_t>&    s1,
-		const std::set<size_t>&    s2)
+		const SelectorSet&         s1,
+		const SelectorSet&         s2)
 	{
-		std::vector<size_t> v(s1.size());
-
-		return std::set_intersection(s1.begin(), s1.end(),
-			s2.begin(), s2.end(), v.begin()) == v.begin();
+		return s1.isDisjoint(s2);
 	}
 
-	static bool isSubset(const std::set<size_t>& s1, const std::set<size_t>& s2)
+	static bool isSubset(const SelectorSet& s1, const SelectorSet& s2)
 	{
-		return std::includes(s1.begin(), s1.end(), s2.begin(), s2.end());
+		return s1.includes(s2);
 	}
 
 
@@ -400,8 +574,35 @@ public:
 		this->data.clear();
 	}
 
+	/**
+	 * @brief  Drops the info about all roots
+	 *
+	 * Marks all @p size roots as invalid, e.g. after the roots of the forest
+	 * automaton have been reordered.
+	 *
+	 * @param[in]  size  The number of roots of the forest automaton
+	 */
+	void reset(size_t size)
+	{
+		this->data.clear();
+		this->data.resize(size);
+	}
+
 	void invalidate(size_t root);
 
+	/**
+	 * @brief  Checks the info about a single root
+	 *
+	 * @param[in]  root  Index of the tree automaton in the forest automaton
+	 * @param[in]  ta    The tree automaton at the index @p root
+	 *
+	 * @returns  @p true if the info about @p root is either invalid or
+	 *           matches the signature computed from @p ta, @p false otherwise
+	 */
+	bool checkRoot(
+		size_t              root,
+		const TreeAut&      ta) const;
+
 	void updateBackwardData(size_t root);
 
 	/**
@@ -21,13 +21,18 @@
 #define EXECUTION_MANAGER_H
 
 // Standard library headers
+#include <limits>
 #include <list>
+#include <map>
+#include <unordered_map>
+#include <vector>
 
 // Forester headers
 #include "types.hh"
 #include "recycler.hh"
 #include "abstractinstruction.hh"
 #include "fixpointinstruction.hh"
+#include "programconfig.hh"
 #include "symstate.hh"
 
 
@@ -42,22 +47,34 @@ private:  // data types
 
 	typedef std::list<SymState*> QueueType;
 
+	/// the queues of states by their priority (the lower the sooner)
+	typedef std::map<size_t, QueueType> QueueMap;
+
 private:  // data members
 
 	/// the root of the execution graph
 	SymState* root_;
 
-	/// the queue with the states to be processed
-	QueueType queue_;
+	/// the queues with the states to be processed
+	QueueMap queue_;
+
+	/// the order in which the states are processed
+	explore_e strategy_;
+
+	/// distances of instructions to the nearest fixpoint instruction
+	std::unordered_map<const AbstractInstruction*, size_t> fixDistance_;
 
 	/// counter of evaluated states
 	size_t statesExecuted_;
 
+	/// counter of states queued behind states of a better priority
+	size_t statesPostponed_;
+
 	/// counter of evaluated paths
 	size_t pathsEvaluated_;
 
 	/// memory manager for registers
-	Recycler<DataArray> registerRecycler_;
+	Recycler<RegisterFile> registerRecycler_;
 	/// memory manager for states
 	Recycler<SymState> stateRecycler_;
 
@@ -65,16 +82,18 @@ private:  // data members
 	{
 	private:  // data members
 
-		Recycler<DataArray>& recycler_;
+		Recycler<RegisterFile>& recycler_;
 
 	public:   // methods
 
-		RecycleRegisterF(Recycler<DataArray>& recycler) :
+		RecycleRegisterF(Recycler<RegisterFile>& recycler) :
 			recycler_(recycler)
 		{ }
 
-		void operator()(DataArray* x)
+		void operator()(RegisterFile* x)
 		{
+			// drop the references to the chunks shared with other states
+			x->clear();
 			recycler_.recycle(x);
 		}
 	};
@@ -84,12 +103,90 @@ private:  // methods
 	ExecutionManager(const ExecutionManager&);
 	ExecutionManager& operator=(const ExecutionManager&);
 
+	/**
+	 * @brief  Gets the priority of a state according to the strategy
+	 *
+	 * @returns  The priority of @p state, the lower the sooner it is processed
+	 */
+	size_t priority(const SymState& state) const
+	{
+		switch (strategy_)
+		{
+			case explore_e::eFixpoint:
+			{
+				auto i = fixDistance_.find(state.GetInstr());
+				return (fixDistance_.end() == i)?
+					std::numeric_limits<size_t>::max() : i->second;
+			}
+
+			case explore_e::eDelayFix:
+				return (fi_type_e::fiFix == state.GetInstr()->getType());
+
+			default:
+				return 0;
+		}
+	}
+
+	void push(SymState* state)
+	{
+		const size_t prio = this->priority(*state);
+		if (!queue_.empty() && (queue_.begin()->first < prio))
+			++statesPostponed_;
+
+		queue_[prio].push_back(state);
+	}
+
+	/**
+	 * @brief  Computes distances of instructions to fixpoint instructions
+	 *
+	 * The distance is the least number of instructions executed before reaching
+	 * a fixpoint instruction.  The instructions that cannot reach a fixpoint
+	 * instruction (as far as it is known statically) are left out.
+	 *
+	 * @param[in]  code  All instructions of the program
+	 */
+	void computeFixDistance(const std::vector<AbstractInstruction*>& code)
+	{
+		std::unordered_map<const AbstractInstruction*,
+			std::vector<const AbstractInstruction*>> preds;
+		std::vector<const AbstractInstruction*> succs;
+		std::list<const AbstractInstruction*> queue;
+
+		fixDistance_.clear();
+		for (const AbstractInstruction* instr : code)
+		{
+			succs.clear();
+			instr->successors(succs);
+			for (const AbstractInstruction* succ : succs)
+				preds[succ].push_back(instr);
+
+			if (fi_type_e::fiFix == instr->getType())
+			{
+				fixDistance_[instr] = 0;
+				queue.push_back(instr);
+			}
+		}
+
+		for (; !queue.empty(); queue.pop_front())
+		{	// breadth-first search over the reversed control flow
+			const size_t dist = fixDistance_[queue.front()] + 1;
+			for (const AbstractInstruction* pred : preds[queue.front()])
+			{
+				if (fixDistance_.insert(std::make_pair(pred, dist)).second)
+					queue.push_back(pred);
+			}
+		}
+	}
+
 public:
 
 	ExecutionManager() :
 		root_(nullptr),
 		queue_{},
+		strategy_(explore_e::eDFS),
+		fixDistance_{},
 		statesExecuted_{},
+		statesPostponed_{},
 		pathsEvaluated_{},
 		registerRecycler_{},
 		stateRecycler_{}
@@ -102,8 +199,12 @@ public:
 
 	size_t statesEvaluated() const { return statesExecuted_; }
 
+	size_t statesPostponed() const { return statesPostponed_; }
+
 	size_t pathsEvaluated() const { return pathsEvaluated_; }
 
+	SymState* root() const { return root_; }
+
 	void clear()
 	{
 		if (nullptr != root_)
@@ -115,9 +216,30 @@ public:
 		queue_.clear();
 
 		statesExecuted_ = 0;
+		statesPostponed_ = 0;
 		pathsEvaluated_ = 0;
 	}
 
+	/**
+	 * @brief  Sets the order in which the states are processed
+	 *
+	 * @param[in]  strategy  The exploration strategy
+	 * @param[in]  code      All instructions of the program
+	 */
+	void setStrategy(
+		explore_e                                strategy,
+		const std::vector<AbstractInstruction*>& code)
+	{
+		// Assertions
+		assert(queue_.empty());
+
+		strategy_ = strategy;
+		if (explore_e::eFixpoint == strategy)
+			this->computeFixDistance(code);
+	}
+
+	explore_e strategy() const { return strategy_; }
+
 	SymState* createState()
 	{
 		SymState* state = stateRecycler_.alloc();
@@ -141,7 +263,7 @@ public:
 		AbstractInstruction*               instr)
 	{
 		SymState* state = createState();
-		const std::shared_ptr<DataArray> regs = allocRegisters(oldState.GetRegs());
+		const std::shared_ptr<RegisterFile> regs = allocRegisters(oldState.GetRegs());
 		state->initChildFrom(&oldState, instr, regs);
 
 		return state;
@@ -160,7 +282,7 @@ public:
 		const SymState&                    oldState)
 	{
 		SymState* state = createState();
-		const std::shared_ptr<DataArray> regs = allocRegisters(oldState.GetRegs());
+		const std::shared_ptr<RegisterFile> regs = allocRegisters(oldState.GetRegs());
 		state->init(oldState, regs);
 
 		return state;
@@ -171,7 +293,7 @@ public:
 		const AbstractInstruction*         insn)
 	{
 		SymState* state = createState();
-		const std::shared_ptr<DataArray> regs = allocRegisters(oldState.GetRegs());
+		const std::shared_ptr<RegisterFile> regs = allocRegisters(oldState.GetRegs());
 		state->init(oldState, regs, const_cast<AbstractInstruction*>(insn));
 
 		return state;
@@ -179,14 +301,14 @@ public:
 
 	SymState* enqueue(
 		SymState*                           parent,
-		const std::shared_ptr<DataArray>&   registers,
+		const std::shared_ptr<RegisterFile>&   registers,
 		const std::shared_ptr<const FAE>&   fae,
 		AbstractInstruction*                instr)
 	{
 		SymState* state = createState();
 
 		state->init(parent, instr, fae, registers);
-		queue_.push_back(state);
+		this->push(state);
 
 		return state;
 	}
@@ -197,47 +319,64 @@ public:
 		// Assertions
 		assert(nullptr != state);
 
-		queue_.push_back(state);
+		this->push(state);
 		return state;
 	}
 
-	SymState* dequeueBFS()
+	/**
+	 * @brief  Takes the next state to be processed
+	 *
+	 * The states of the best priority go first.  Those of the same priority are
+	 * taken in the FIFO order for breadth-first search and in the LIFO order
+	 * otherwise.
+	 *
+	 * @returns  The next state or @p nullptr if there is none
+	 */
+	SymState* dequeue()
 	{
 		if (queue_.empty())
 			return nullptr;
 
-		SymState* state = queue_.front();
-		assert(nullptr != state);
+		QueueMap::iterator i = queue_.begin();
+		QueueType& queue = i->second;
+		assert(!queue.empty());
 
-		queue_.pop_front();
+		SymState* state;
+		if (explore_e::eBFS == strategy_)
+		{
+			state = queue.front();
+			queue.pop_front();
+		}
+		else
+		{
+			state = queue.back();
+			queue.pop_back();
+		}
 
-		return state;
-	}
+		if (queue.empty())
+			queue_.erase(i);
 
-	SymState* dequeueDFS()
-	{
-		if (queue_.empty())
-			return nullptr;
-
-		SymState* state = queue_.back();
 		assert(nullptr != state);
-
-		queue_.pop_back();
-
 		return state;
 	}
 
-	std::shared_ptr<DataArray> allocRegisters(const DataArray& model)
+	/**
+	 * @brief  Allocates a register file with the values of another one
+	 *
+	 * The new register file shares the values with @p model until either of
+	 * them is written, see RegisterFile.
+	 */
+	std::shared_ptr<RegisterFile> allocRegisters(const RegisterFile& model)
 	{
-		DataArray* v = registerRecycler_.alloc();
+		RegisterFile* v = registerRecycler_.alloc();
 		assert(nullptr != v);
 
 		*v = model;
 
-		return std::shared_ptr<DataArray>(v, RecycleRegisterF(registerRecycler_));
+		return std::shared_ptr<RegisterFile>(v, RecycleRegisterF(registerRecycler_));
 	}
 
-	void init(const DataArray& registers, const std::shared_ptr<const FAE>& fae,
+	void init(const RegisterFile& registers, const std::shared_ptr<const FAE>& fae,
 		AbstractInstruction* instr)
 	{
 		this->clear();
@@ -21,10 +21,12 @@
 #include <ostream>
 
 // Code Listener headers
+#include <cl/perfstats.hh>
 #include <cl/storage.hh>
 
 // Forester headers
 #include "abstraction.hh"
+#include "componentman.hh"
 #include "config.h"
 #include "executionmanager.hh"
 #include "fixpoint.hh"
@@ -211,6 +213,8 @@ bool fold(
 	BoxMan&                      boxMan,
 	const std::set<size_t>&      forbidden)
 {
+	PERF_TIMER("fa.folding");
+
 	std::vector<size_t> order;
 	std::vector<bool> marked;
 
@@ -291,6 +295,8 @@ bool testInclusion(
 	TreeAut&                       fwdConf,
 	UFAE&                          fwdConfWrapper)
 {
+	PERF_TIMER("fa.fixpoint_inclusion");
+
 	TreeAut ta(*fwdConf.backend);
 
 	Index<size_t> index;
@@ -412,6 +418,8 @@ SymState* FixpointBase::reverseAndIsect(
 void FI_abs::abstract(
 	FAE&                 fae)
 {
+	PERF_TIMER("fa.abstraction");
+
 	fae.unreachableFree();
 
 	FA_DEBUG_AT(3, "before abstraction: " << std::endl << fae);
@@ -473,6 +481,37 @@ void FI_abs::abstract(
 }
 
 
+void FixpointBase::continueWith(
+	ExecutionManager&                  execMan,
+	SymState&                          state,
+	const std::shared_ptr<FAE>&        fae)
+{
+	// share the components with the other states
+	ComponentMan::instance().internRoots(*fae);
+
+	if (FA_USE_PREDICATE_ABSTRACTION && FA_REFINE_FROM_FAILPOINT)
+	{	// keep the state in case the analysis is resumed after refinement
+		extensions_.push_back(std::make_pair(state.GetRegs(), fae));
+	}
+
+	SymState* tmpState = execMan.createChildState(state, next_);
+	tmpState->SetFAE(fae);
+
+	execMan.enqueue(tmpState);
+}
+
+void FixpointBase::resume(
+	ExecutionManager&                  execMan,
+	SymState*                          parent,
+	std::vector<const SymState*>&      dst) const
+{
+	for (const auto& ext : extensions_)
+	{
+		dst.push_back(execMan.enqueue(
+			parent, execMan.allocRegisters(ext.first), ext.second, next_));
+	}
+}
+
 // FI_abs
 void FI_abs::execute(ExecutionManager& execMan, SymState& state)
 {
@@ -541,10 +580,7 @@ void FI_abs::execute(ExecutionManager& execMan, SymState& state)
 	{
 		FA_DEBUG_AT_MSG(1, &this->insn()->loc, "extending fixpoint\n" << *fae);
 
-		SymState* tmpState = execMan.createChildState(state, next_);
-		tmpState->SetFAE(fae);
-
-		execMan.enqueue(tmpState);
+		this->continueWith(execMan, state, fae);
 	}
 }
 
@@ -607,9 +643,6 @@ void FI_fix::execute(ExecutionManager& execMan, SymState& state)
 	{
 		FA_DEBUG_AT_MSG(1, &this->insn()->loc, "extending fixpoint\n" << *fae);
 
-		SymState* tmpState = execMan.createChildState(state, next_);
-		tmpState->SetFAE(fae);
-
-		execMan.enqueue(tmpState);
+		this->continueWith(execMan, state, fae);
 	}
 }
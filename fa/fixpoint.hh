@@ -28,6 +28,7 @@
 #include "boxman.hh"
 #include "fixpointinstruction.hh"
 #include "forestautext.hh"
+#include "registerfile.hh"
 #include "ufae.hh"
 
 /**
@@ -44,10 +45,27 @@ protected:
 
 	std::vector<std::shared_ptr<const FAE>> fixpoint_;
 
+	/// The states that extended the fixpoint (see FA_REFINE_FROM_FAILPOINT)
+	std::vector<std::pair<RegisterFile, std::shared_ptr<const FAE>>> extensions_;
+
 	TreeAut::Backend& taBackend_;
 
 	BoxMan& boxMan_;
 
+protected:
+
+	/**
+	 * @brief  Continues the execution with a state that extended the fixpoint
+	 *
+	 * @param[in,out]  execMan  The execution manager
+	 * @param[in]      state    The state executing the instruction
+	 * @param[in]      fae      The forest automaton after the instruction
+	 */
+	void continueWith(
+		ExecutionManager&                  execMan,
+		SymState&                          state,
+		const std::shared_ptr<FAE>&        fae);
+
 public:
 
 	virtual void extendFixpoint(const std::shared_ptr<const FAE>& fae)
@@ -58,10 +76,16 @@ public:
 	virtual void clear()
 	{
 		fixpoint_.clear();
+		extensions_.clear();
 		fwdConf_.clear();
 		fwdConfWrapper_.clear();
 	}
 
+	virtual void resume(
+		ExecutionManager&                  execMan,
+		SymState*                          parent,
+		std::vector<const SymState*>&      dst) const;
+
 #if 0
 	void recompute()
 	{
@@ -94,6 +118,7 @@ public:
 		fwdConf_(fixpointBackend),
 		fwdConfWrapper_(fwdConf_, boxMan),
 		fixpoint_{},
+		extensions_{},
 		taBackend_(taBackend),
 		boxMan_(boxMan)
 	{ }
@@ -21,6 +21,7 @@
 #define FIXPOINT_INSTRUCTION_H
 
 #include <memory>
+#include <vector>
 
 #include "treeaut_label.hh"
 
@@ -39,6 +40,21 @@ public:
 
 	virtual const TreeAut& getFixPoint() const = 0;
 
+	/**
+	 * @brief  Schedules again the states that extended the fixpoint
+	 *
+	 * The states are kept only if the analysis may be refined from the point of
+	 * failure, see FA_REFINE_FROM_FAILPOINT.
+	 *
+	 * @param[in,out]  execMan  The execution manager
+	 * @param[in]      parent   The state to be the parent of the new states
+	 * @param[out]     dst      The vector the new states are appended to
+	 */
+	virtual void resume(
+		ExecutionManager&                  execMan,
+		SymState*                          parent,
+		std::vector<const SymState*>&      dst) const = 0;
+
 };
 
 #endif
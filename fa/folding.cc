@@ -239,6 +239,27 @@ std::vector<size_t> extractInputMap(
 	return inputMap;
 }
 
+/**
+ * @brief  Checks whether a box references a forbidden cutpoint
+ *
+ * @param[in]  cutpoints  Indices of the cutpoints referenced by the box
+ * @param[in]  forbidden  The set of cutpoints not allowed for folding
+ *
+ * @returns  @p true if any of @p cutpoints is in @p forbidden
+ */
+bool isForbidden(
+	const std::vector<size_t>&                   cutpoints,
+	const std::set<size_t>&                      forbidden)
+{
+	for (size_t cutpoint : cutpoints)
+	{
+		if (forbidden.count(cutpoint))
+			return true;
+	}
+
+	return false;
+}
+
 } // namespace
 
 
@@ -282,6 +303,32 @@ const ConnectionGraph::StateToCutpointSignatureMap& Folding::getSignatures(
 }
 
 
+ComponentMan::FoldKey Folding::getFoldKey(
+	size_t      root,
+	size_t      state,
+	size_t      aux,
+	bool        pair,
+	bool        conditional)
+{
+	ComponentMan& compMan = ComponentMan::instance();
+
+	// interning does not change the language of the components, hence the
+	// connection graph and the signatures stay valid
+	fae_.replaceRoot(root, compMan.intern(fae_.getRoot(root)));
+	if (pair)
+		fae_.replaceRoot(aux, compMan.intern(fae_.getRoot(aux)));
+
+	return ComponentMan::FoldKey{
+		root,
+		state,
+		aux,
+		(pair)? compMan.id(*fae_.getRoot(aux)) : static_cast<size_t>(-1),
+		conditional,
+		boxMan_.generation()
+	};
+}
+
+
 bool Folding::discover1(
 	size_t                       root,
 	const std::set<size_t>&      forbidden,
@@ -613,9 +660,7 @@ void Folding::componentCut(
 			complementSignature[i].refCount =
 				std::max(complementSignature[i].refCount, tmp[i].refCount);
 
-			complementSignature[i].fwdSelectors.insert(
-				tmp[i].fwdSelectors.begin(), tmp[i].fwdSelectors.end()
-			);
+			complementSignature[i].fwdSelectors.insert(tmp[i].fwdSelectors);
 		}
 
 		// add the new transition to the source automaton
@@ -643,6 +688,24 @@ const Box* Folding::makeType1Box(
 	assert(root < fae_.getRootCount());
 	assert(nullptr != fae_.getRoot(root));
 
+	ComponentMan& compMan = ComponentMan::instance();
+	const ComponentMan::FoldKey key = this->getFoldKey(
+		root, state, aux, /* pair */ false, conditional);
+
+	// check whether the same attempt has already been made
+	const ComponentMan::FoldResult* memo =
+		compMan.lookupFold(*fae_.getRoot(root), key);
+
+	if (memo && (!memo->box || isForbidden(memo->cutpoints, forbidden)))
+	{	// in the case the box is known not to be foldable here
+		return nullptr;
+	}
+
+	if (memo && test)
+	{	// in the case we are only testing
+		return memo->box;
+	}
+
 	// 'index' maintains for each cutpoint of the FA either '-1' which means that
 	// the box does not reference it, or the order in which it is referenced in
 	// the box
@@ -680,30 +743,46 @@ const Box* Folding::makeType1Box(
 		}
 	}
 
-	if (!Folding::computeSelectorMap(selectorMap, root, state))
-	{	// in the case the box cannot be created (not all transitions from 'state'
-		// have the same signature)
-		return nullptr;
-	}
+	const Box* boxPtr = (memo)? (memo->box) : (nullptr);
 
-	// get the input mapping of components to selector offsets
-	std::vector<size_t> inputMap = extractInputMap(selectorMap, root, index);
-
-	// create a box with a single TA
-	std::unique_ptr<Box> box = std::unique_ptr<Box>(
-		BoxMan::createType1Box(
-			/* index of the TA put in the box */ root,
-			/* the TA */ this->relabelReferences(*resKerPair.second, index),
-			/* signature of the TA */ outputSignature,
-			/* mapping of cutpoints to selectos */ inputMap,
-			/* index renaming cutpoints */ index
-		)
-	);
+	if (!memo)
+	{	// in the case the box has not been evaluated yet
+		if (!Folding::computeSelectorMap(selectorMap, root, state))
+		{	// in the case the box cannot be created (not all transitions from
+			// 'state' have the same signature)
+			compMan.storeFold(*fae_.getRoot(root), key, { nullptr, { } });
 
-	// find the box in the database
-	const Box* boxPtr = this->getBox(
-		/* the box */ *box,
-		/* false if we wish to insert the box if not present */ conditional);
+			return nullptr;
+		}
+
+		// get the input mapping of components to selector offsets
+		std::vector<size_t> inputMap = extractInputMap(selectorMap, root, index);
+
+		// create a box with a single TA
+		std::unique_ptr<Box> box = std::unique_ptr<Box>(
+			BoxMan::createType1Box(
+				/* index of the TA put in the box */ root,
+				/* the TA */ this->relabelReferences(*resKerPair.second, index),
+				/* signature of the TA */ outputSignature,
+				/* mapping of cutpoints to selectos */ inputMap,
+				/* index renaming cutpoints */ index
+			)
+		);
+
+		// find the box in the database
+		boxPtr = this->getBox(
+			/* the box */ *box,
+			/* false if we wish to insert the box if not present */ conditional);
+
+		if (boxMan_.generation() == key.generation)
+		{	// in the case no box has been learned meanwhile, remember the outcome
+			std::vector<size_t> cutpoints;
+			for (const ConnectionGraph::CutpointInfo& cutpoint : outputSignature)
+				cutpoints.push_back(cutpoint.root);
+
+			compMan.storeFold(*fae_.getRoot(root), key, { boxPtr, cutpoints });
+		}
+	}
 
 	if (test)
 	{	// in the case we are only testing
@@ -731,8 +810,6 @@ const Box* Folding::makeType1Box(
 			/* signature of the box */ outputSignature)
 		);
 
-	fae_.connectionGraph.invalidate(root);
-
 	this->invalidateSignatures(root);
 
 	return boxPtr;
@@ -754,6 +831,24 @@ const Box* Folding::makeType2Box(
 
 	size_t finalState = fae_.getRoot(root)->getFinalState();
 
+	ComponentMan& compMan = ComponentMan::instance();
+	const ComponentMan::FoldKey key = this->getFoldKey(
+		root, finalState, aux, /* pair */ true, conditional);
+
+	// check whether the same attempt has already been made
+	const ComponentMan::FoldResult* memo =
+		compMan.lookupFold(*fae_.getRoot(root), key);
+
+	if (memo && (!memo->box || isForbidden(memo->cutpoints, forbidden)))
+	{	// in the case the box is known not to be foldable here
+		return nullptr;
+	}
+
+	if (memo && test)
+	{	// in the case we are only testing
+		return memo->box;
+	}
+
 	std::vector<size_t> index(fae_.getRootCount(), static_cast<size_t>(-1)), index2;
 	std::vector<bool> rootMask(fae_.getRootCount(), false);
 
@@ -774,6 +869,8 @@ const Box* Folding::makeType2Box(
 	{
 		if (cutpoint.root == root)
 		{	// if this procedure cannot fold the sub-structure
+			compMan.storeFold(*fae_.getRoot(root), key, { nullptr, { } });
+
 			return nullptr;
 		}
 
@@ -794,12 +891,19 @@ const Box* Folding::makeType2Box(
 		}
 	}
 
-	if (!Folding::computeSelectorMap(selectorMap, root, finalState))
-	{
-		return nullptr;
-	}
+	std::vector<size_t> inputMap;
+
+	if (!memo)
+	{	// in the case the box has not been evaluated yet
+		if (!Folding::computeSelectorMap(selectorMap, root, finalState))
+		{
+			compMan.storeFold(*fae_.getRoot(root), key, { nullptr, { } });
+
+			return nullptr;
+		}
 
-	std::vector<size_t> inputMap = extractInputMap(selectorMap, root, index);
+		inputMap = extractInputMap(selectorMap, root, index);
+	}
 
 	auto auxP = this->separateCutpoint(
 		inputSignature, aux, fae_.getRoot(aux)->getFinalState(), root
@@ -816,6 +920,8 @@ const Box* Folding::makeType2Box(
 	{
 		if (cutpoint.refCount > 1)
 		{
+			compMan.storeFold(*fae_.getRoot(root), key, { nullptr, { } });
+
 			return nullptr;
 		}
 
@@ -838,31 +944,48 @@ const Box* Folding::makeType2Box(
 		}
 	}
 
-	selectorMap.clear();
+	const Box* boxPtr = (memo)? (memo->box) : (nullptr);
 
-	if (!Folding::computeSelectorMap(selectorMap, aux,
-		fae_.getRoot(aux)->getFinalState()))
-	{
-		assert(false);           // fail gracefully
-	}
+	if (!memo)
+	{	// in the case the box has not been evaluated yet
+		selectorMap.clear();
 
-	size_t selector = extractSelector(selectorMap, root);
+		if (!Folding::computeSelectorMap(selectorMap, aux,
+			fae_.getRoot(aux)->getFinalState()))
+		{
+			assert(false);           // fail gracefully
+		}
 
-	std::unique_ptr<Box> box = std::unique_ptr<Box>(
-		BoxMan::createType2Box(
-			root,
-			this->relabelReferences(*resKerPair.second, index),
-			outputSignature,
-			inputMap,
-			aux,
-			this->relabelReferences(*auxP.second, index2),
-			inputSignature,
-			selector,
-			index
-		)
-	);
+		size_t selector = extractSelector(selectorMap, root);
+
+		std::unique_ptr<Box> box = std::unique_ptr<Box>(
+			BoxMan::createType2Box(
+				root,
+				this->relabelReferences(*resKerPair.second, index),
+				outputSignature,
+				inputMap,
+				aux,
+				this->relabelReferences(*auxP.second, index2),
+				inputSignature,
+				selector,
+				index
+			)
+		);
+
+		boxPtr = this->getBox(*box, conditional);
+
+		if (boxMan_.generation() == key.generation)
+		{	// in the case no box has been learned meanwhile, remember the outcome
+			std::vector<size_t> cutpoints;
+			for (const ConnectionGraph::CutpointInfo& cutpoint : outputSignature)
+				cutpoints.push_back(cutpoint.root);
 
-	auto boxPtr = this->getBox(*box, conditional);
+			for (const ConnectionGraph::CutpointInfo& cutpoint : inputSignature)
+				cutpoints.push_back(cutpoint.root);
+
+			compMan.storeFold(*fae_.getRoot(root), key, { boxPtr, cutpoints });
+		}
+	}
 
 	if (test)
 	{
@@ -890,12 +1013,9 @@ const Box* Folding::makeType2Box(
 			outputSignature)
 		);
 
-	fae_.connectionGraph.invalidate(root);
-
 	this->invalidateSignatures(root);
 
 	fae_.setRoot(aux, auxP.first);
-	fae_.connectionGraph.invalidate(aux);
 
 	this->invalidateSignatures(aux);
 
@@ -30,6 +30,7 @@
 // Forester headers
 #include "abstractbox.hh"
 #include "boxman.hh"
+#include "componentman.hh"
 #include "config.h"
 #include "connection_graph.hh"
 #include "forestautext.hh"
@@ -116,6 +117,30 @@ protected:
 		size_t        root);
 
 
+	/**
+	 * @brief  Gets the key of the memo of attempts to fold a box
+	 *
+	 * The attempts to fold a box are remembered by ComponentMan for the
+	 * component at @p root (see ComponentMan::lookupFold()).  Therefore, the
+	 * component at @p root (and the one at @p aux if @p pair is set) is
+	 * interned in the FA.
+	 *
+	 * @param[in]  root         Index of the component where the box is folded
+	 * @param[in]  state        The state under which the box is folded
+	 * @param[in]  aux          Index of another component
+	 * @param[in]  pair         @p true for boxes with two components
+	 * @param[in]  conditional  @p true if the box is only looked up
+	 *
+	 * @returns  The key of the attempt
+	 */
+	ComponentMan::FoldKey getFoldKey(
+		size_t        root,
+		size_t        state,
+		size_t        aux,
+		bool          pair,
+		bool          conditional);
+
+
 	/**
 	 * @brief  Invalidates the signature of given root
 	 *
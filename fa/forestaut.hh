@@ -179,7 +179,30 @@ public:   // methods
 		return roots_[i];
 	}
 
+	/**
+	 * @brief  Replaces a root and invalidates its info in the connection graph
+	 *
+	 * @param[in]  i   Index of the root to be replaced
+	 * @param[in]  ta  The new tree automaton (may be @p nullptr)
+	 */
 	void setRoot(size_t i, std::shared_ptr<TreeAut> ta)
+	{
+		assert(i < this->getRootCount());
+		roots_[i] = ta;
+		this->connectionGraph.invalidate(i);
+	}
+
+	/**
+	 * @brief  Replaces a root keeping its info in the connection graph
+	 *
+	 * To be used only by callers that keep the connection graph consistent
+	 * themselves, e.g. when the new tree automaton accepts the same language
+	 * (interning) or when the graph is updated by the caller (normalization).
+	 *
+	 * @param[in]  i   Index of the root to be replaced
+	 * @param[in]  ta  The new tree automaton (may be @p nullptr)
+	 */
+	void replaceRoot(size_t i, std::shared_ptr<TreeAut> ta)
 	{
 		assert(i < this->getRootCount());
 		roots_[i] = ta;
@@ -188,6 +211,7 @@ public:   // methods
 	void appendRoot(TreeAut* ta)
 	{
 		roots_.push_back(std::shared_ptr<TreeAut>(ta));
+		this->connectionGraph.newRoot();
 	}
 
 	const std::vector<std::shared_ptr<TreeAut>>& getRoots() const
@@ -198,6 +222,7 @@ public:   // methods
 	void appendRoot(std::shared_ptr<TreeAut> ta)
 	{
 		roots_.push_back(ta);
+		this->connectionGraph.newRoot();
 	}
 
 	void resizeRoots(size_t newSize)
@@ -18,6 +18,7 @@
  */
 
 // Forester headers
+#include "componentman.hh"
 #include "forestautext.hh"
 #include "streams.hh"
 
@@ -31,7 +32,7 @@ bool FAE::subseteq(const FAE& lhs, const FAE& rhs)
 
 	for (size_t i = 0; i < lhs.getRootCount(); ++i)
 	{
-		if (!TreeAut::subseteq(*lhs.getRoot(i), *rhs.getRoot(i)))
+		if (!ComponentMan::instance().subseteq(*lhs.getRoot(i), *rhs.getRoot(i)))
 			return false;
 	}
 
@@ -152,10 +152,9 @@ public:
 		size_t                          stateOffset,
 		F                               funcCompat)
 	{
-		// build TD cache and insert empty set of root transitions (if not present)
-		TreeAut::td_cache_type cache = src.buildTDCache();
-		std::vector<const Transition*>& v = cache.insert(
-			std::make_pair(0, std::vector<const Transition*>())).first->second;
+		// get the TD cache and the (possibly empty) set of root transitions
+		const TreeAut::td_cache_type& cache = src.getTDCache();
+		const std::vector<const Transition*>& v = TreeAut::tdLookup(cache, 0);
 
 		for (const Transition* trans : v)
 		{ // iterate over all "synthetic" transitions and constuct new FAE for each
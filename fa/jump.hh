@@ -80,6 +80,10 @@ public:
 		return os << "jmp   \t" << this->next_;
 	}
 
+	virtual void successors(std::vector<const AbstractInstruction*>& dst) const {
+		dst.push_back(this->next_);
+	}
+
 };
 
 #endif
@@ -20,79 +20,260 @@
 #ifndef LTS_H
 #define LTS_H
 
-#include "smartset.hh"
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
 
+/**
+ * @brief labelled transition system stored in the compressed sparse row form
+ *
+ * The transitions are first collected by addTransition() and then compressed
+ * by finalize().  Afterwards, the predecessors are grouped by the target state
+ * and by the label (pre(), lPre()) and the successors by the source state and
+ * by the label (post()), so that the memory needed is proportional to the
+ * number of transitions rather than to labels x states.
+ */
 class LTS {
 
+public:   // data types
+
+	/// a contiguous range of indices within the compressed storage
+	class Range {
+
+		const size_t* _begin;
+		const size_t* _end;
+
+	public:
+
+		typedef const size_t* const_iterator;
+
+		Range(const size_t* begin = nullptr, const size_t* end = nullptr) :
+			_begin(begin), _end(end) {}
+
+		const_iterator begin() const { return this->_begin; }
+		const_iterator end() const { return this->_end; }
+		size_t size() const { return this->_end - this->_begin; }
+		bool empty() const { return this->_begin == this->_end; }
+
+	};
+
+private:  // data types
+
+	struct Transition {
+		size_t q;
+		size_t a;
+		size_t r;
+	};
+
+	/// transitions grouped by a state, then by a label
+	struct Rows {
+		/// segments of the state i are rowStart[i] .. rowStart[i + 1] - 1
+		std::vector<size_t> rowStart;
+		/// label of each segment, sorted within the row
+		std::vector<size_t> segLabel;
+		/// items of the segment i are items[segStart[i] .. segStart[i + 1] - 1]
+		std::vector<size_t> segStart;
+		std::vector<size_t> items;
+
+		Rows() : rowStart{}, segLabel{}, segStart{}, items{} {}
+
+		size_t find(size_t state, size_t label) const {
+			const std::vector<size_t>::const_iterator
+				begin = this->segLabel.begin() + this->rowStart[state],
+				end = this->segLabel.begin() + this->rowStart[state + 1],
+				i = std::lower_bound(begin, end, label);
+			if (i == end || *i != label)
+				return static_cast<size_t>(-1);
+			return i - this->segLabel.begin();
+		}
+
+		Range segment(size_t seg) const {
+			const size_t* data = this->items.data();
+			return Range(data + this->segStart[seg], data + this->segStart[seg + 1]);
+		}
+	};
+
+private:  // data members
+
 	size_t _labels;
 	size_t _states;
 	size_t _transitions;
-	std::vector<std::vector<std::vector<size_t> > > _dataPre;
-	std::vector<SmartSet> _lPre;
+	bool _finalized;
+	std::vector<Transition> _pending;
+	/// predecessors grouped by the target state
+	Rows _pre;
+	/// for each predecessor in _pre, its key within sources() of the label
+	std::vector<size_t> _preKey;
+	/// successors grouped by the source state
+	Rows _post;
+	/// sources of the label a are _srcItems[_srcStart[a] .. _srcStart[a + 1] - 1]
+	std::vector<size_t> _srcStart;
+	std::vector<size_t> _srcItems;
+
+private:  // methods
+
+	/// stable counting sort of the pending transitions into the given rows
+	template <class F>
+	void buildRows(Rows& rows, size_t (Transition::*state), size_t (Transition::*item), F key) const {
+		const size_t n = this->_pending.size();
+
+		// order by (state, label), the original order is kept within segments
+		std::vector<size_t> byLabel(n), order(n), count(std::max(this->_labels, this->_states) + 1);
+		for (size_t i = 0; i < n; ++i)
+			++count[this->_pending[i].a + 1];
+		for (size_t i = 1; i <= this->_labels; ++i)
+			count[i] += count[i - 1];
+		for (size_t i = 0; i < n; ++i)
+			byLabel[count[this->_pending[i].a]++] = i;
+		std::fill(count.begin(), count.end(), 0);
+		for (size_t i = 0; i < n; ++i)
+			++count[this->_pending[i].*state + 1];
+		for (size_t i = 1; i <= this->_states; ++i)
+			count[i] += count[i - 1];
+		for (size_t i = 0; i < n; ++i)
+			order[count[this->_pending[byLabel[i]].*state]++] = byLabel[i];
+
+		rows.rowStart.assign(this->_states + 1, 0);
+		rows.segLabel.clear();
+		rows.segStart.clear();
+		rows.items.resize(n);
+		for (size_t i = 0; i < n; ++i) {
+			const Transition& t = this->_pending[order[i]];
+			if (!i || t.*state != this->_pending[order[i - 1]].*state || t.a != this->_pending[order[i - 1]].a) {
+				++rows.rowStart[t.*state + 1];
+				rows.segLabel.push_back(t.a);
+				rows.segStart.push_back(i);
+			}
+			rows.items[i] = t.*item;
+			key(t, i);
+		}
+		rows.segStart.push_back(n);
+		for (size_t i = 1; i <= this->_states; ++i)
+			rows.rowStart[i] += rows.rowStart[i - 1];
+	}
+
+	void checkFinalized() const {
+		if (!this->_finalized)
+			throw std::runtime_error("LTS::finalize() has not been called");
+	}
 
 public:
 
 	LTS(size_t labels = 0, size_t states = 0) :
-		_labels(labels), _states(states), _transitions(0),
-		_dataPre(labels, std::vector<std::vector<size_t> >(states)),
-		_lPre(states, SmartSet(labels)) {}
-/*
-	LTS(const LTS& lts) :
-		_labels(lts._labels), _states(lts._states), _transitions(lts._transitions),
-		_dataPre(lts._dataPre),
-		_lPre(lts._lPre) {}
-*/
+		_labels(labels), _states(states), _transitions(0), _finalized(false),
+		_pending{}, _pre{}, _preKey{}, _post{}, _srcStart{}, _srcItems{} {}
+
 	void addTransition(size_t q, size_t a, size_t r) {
-		if (a >= this->_dataPre.size())
+		if (this->_finalized)
+			throw std::runtime_error("LTS already finalized");
+		if (a >= this->_labels)
 			throw std::runtime_error("label index out of range");
-		if (r >= this->_dataPre[a].size()) {
-			std::cout << r << "<" << this->_dataPre[a].size() << "\n";
+		if (r >= this->_states) {
+			std::cout << r << "<" << this->_states << "\n";
 			throw std::runtime_error("state index out of range");
 		}
-		if (q >= this->_dataPre[a].size())
+		if (q >= this->_states)
 			throw std::runtime_error("state index out of range");
-		this->_dataPre[a][r].push_back(q);
-		this->_lPre[r].add(a);
+		this->_pending.push_back(Transition{q, a, r});
 		++this->_transitions;
 	}
 
-	const std::vector<size_t>& pre(size_t q, size_t a) const {
-		return this->_dataPre[a][q];
-	}
-/*
-	method iter f =
-    Array.iteri (fun a pre_a -> Array.iteri (fun r pre_a_r -> List.iter (fun q -> f q a r) pre_a_r) pre_a) _data_pre
-*/
-	const std::vector<std::vector<std::vector<size_t> > >& dataPre() const { return this->_dataPre; }
-
-	void buildPost(size_t label, std::vector<std::vector<size_t> >& dst) const {
-		dst.clear();
-		dst.resize(this->_states);
-		for (size_t i = 0; i < this->_dataPre[label].size(); ++i) {
-			for (std::vector<size_t>::const_iterator j = this->_dataPre[label][i].begin(); j != this->_dataPre[label][i].end(); ++j)
-				dst[*j].push_back(i);
+	/// compress the transitions added so far, no more can be added then
+	void finalize() {
+		if (this->_finalized)
+			return;
+
+		this->buildRows(this->_post, &Transition::q, &Transition::r, [](const Transition&, size_t) {});
+
+		// the sources of each label in ascending order, duplicates removed
+		this->_srcStart.assign(this->_labels + 1, 0);
+		this->_srcItems.clear();
+		std::vector<size_t> perLabel(this->_labels + 1);
+		for (size_t q = 0; q < this->_states; ++q) {
+			for (size_t s = this->_post.rowStart[q]; s < this->_post.rowStart[q + 1]; ++s)
+				++perLabel[this->_post.segLabel[s] + 1];
 		}
-	}
-	
-	void buildDelta(std::vector<SmartSet>& delta, std::vector<SmartSet>& delta1) const {
-		delta.resize(this->_labels);
-		delta1.resize(this->_labels);
-		for (size_t a = 0; a < this->_labels; ++a) {
-			delta[a] = SmartSet(this->_states);
-			delta1[a] = SmartSet(this->_states);
-			for (size_t i = 0; i < this->_dataPre[a].size(); ++i) {
-				for (std::vector<size_t>::const_iterator j = this->_dataPre[a][i].begin(); j != this->_dataPre[a][i].end(); ++j) {
-					delta[a].add(i);
-					delta1[a].add(*j);
-				}
-			}
+		for (size_t a = 1; a <= this->_labels; ++a)
+			perLabel[a] += perLabel[a - 1];
+		this->_srcStart = perLabel;
+		this->_srcItems.resize(perLabel[this->_labels]);
+		for (size_t q = 0; q < this->_states; ++q) {
+			for (size_t s = this->_post.rowStart[q]; s < this->_post.rowStart[q + 1]; ++s)
+				this->_srcItems[perLabel[this->_post.segLabel[s]]++] = q;
 		}
+
+		this->_preKey.resize(this->_pending.size());
+		this->buildRows(this->_pre, &Transition::r, &Transition::q, [this](const Transition& t, size_t i) {
+			this->_preKey[i] = this->key(t.q, t.a);
+		});
+
+		std::vector<Transition>().swap(this->_pending);
+		this->_finalized = true;
+	}
+
+	bool finalized() const {
+		return this->_finalized;
+	}
+
+	/// predecessors of the state r via the label a
+	Range pre(size_t r, size_t a) const {
+		this->checkFinalized();
+		const size_t seg = this->_pre.find(r, a);
+		if (seg == static_cast<size_t>(-1))
+			return Range();
+		return this->_pre.segment(seg);
+	}
+
+	/// key() of each predecessor returned by pre(r, a), in the same order
+	Range preKeys(size_t r, size_t a) const {
+		this->checkFinalized();
+		const size_t seg = this->_pre.find(r, a);
+		if (seg == static_cast<size_t>(-1))
+			return Range();
+		const size_t* data = this->_preKey.data();
+		return Range(data + this->_pre.segStart[seg], data + this->_pre.segStart[seg + 1]);
+	}
+
+	/// successors of the state q via the label a
+	Range post(size_t q, size_t a) const {
+		this->checkFinalized();
+		const size_t seg = this->_post.find(q, a);
+		if (seg == static_cast<size_t>(-1))
+			return Range();
+		return this->_post.segment(seg);
+	}
+
+	/// labels of the transitions leading to the state r, in ascending order
+	Range lPre(size_t r) const {
+		this->checkFinalized();
+		const size_t* data = this->_pre.segLabel.data();
+		return Range(data + this->_pre.rowStart[r], data + this->_pre.rowStart[r + 1]);
+	}
+
+	/// states having an outgoing transition labelled by a, in ascending order
+	Range sources(size_t a) const {
+		this->checkFinalized();
+		const size_t* data = this->_srcItems.data();
+		return Range(data + this->_srcStart[a], data + this->_srcStart[a + 1]);
 	}
 
-	const std::vector<SmartSet>& lPre() const {
-		return this->_lPre;
+	/// position of the state q within sources(a), -1 if q is not there
+	size_t key(size_t q, size_t a) const {
+		const std::vector<size_t>::const_iterator
+			begin = this->_srcItems.begin() + this->_srcStart[a],
+			end = this->_srcItems.begin() + this->_srcStart[a + 1],
+			i = std::lower_bound(begin, end, q);
+		if (i == end || *i != q)
+			return static_cast<size_t>(-1);
+		return i - begin;
 	}
-	
+
+	bool isSource(size_t q, size_t a) const {
+		this->checkFinalized();
+		return this->_post.find(q, a) != static_cast<size_t>(-1);
+	}
+
 	size_t labels() const {
 		return this->_labels;
 	}
@@ -101,32 +282,25 @@ public:
 		return this->_states;
 	}
 
+	size_t transitions() const {
+		return this->_transitions;
+	}
+
 	void dump() const {
 		std::cout << "states: " << this->_states << ", labels: " << this->_labels << std::endl;
-		for (size_t i = 0; i < this->_labels; ++i) {
-			for (size_t j = 0; j < this->_states; ++j) {
-				for (size_t k = 0; k < this->_dataPre[i][j].size(); ++k)
-					std::cout << this->_dataPre[i][j][k] << " --" << i << "--> " << j << std::endl;
+		if (!this->_finalized) {
+			for (const Transition& t : this->_pending)
+				std::cout << t.q << " --" << t.a << "--> " << t.r << std::endl;
+			return;
+		}
+		for (size_t r = 0; r < this->_states; ++r) {
+			for (size_t s = this->_pre.rowStart[r]; s < this->_pre.rowStart[r + 1]; ++s) {
+				for (size_t q : this->_pre.segment(s))
+					std::cout << q << " --" << this->_pre.segLabel[s] << "--> " << r << std::endl;
 			}
 		}
 	}
 
-/*
-(*
-		method setData d = (
-		_data <- d;
-		_nsymbols <- Array.length _data;
-		_nstates <- Array.length _data.(0)
-	)
-*)	
-	method nsymbols = _nsymbols
-	method nstates = _nstates
-	method ntransitions = _ntransitions
-	
-	method stats =
-		Printf.sprintf "states: %d, symbols: %d, transitions: %d" _nstates _nsymbols _ntransitions
-
-*/
 };
 
 #endif
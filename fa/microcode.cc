@@ -51,6 +51,14 @@ inline const cl_loc* getLoc(const SymState& state)
 	return &(state.GetInstr()->insn()->loc);
 }
 
+inline const cl_loc* getLoc(const AbstractInstruction& instr)
+{
+	if (!instr.insn())
+		return nullptr;
+
+	return &(instr.insn()->loc);
+}
+
 } // namespace
 
 // FI_cond
@@ -172,97 +180,75 @@ void FI_acc_all::execute(ExecutionManager& execMan, SymState& state)
 }
 
 // FI_load_cst
-void FI_load_cst::execute(ExecutionManager& execMan, SymState& state)
+void FI_load_cst::assign(const SymState& /* state */, SymState& tmpState) const
 {
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-	tmpState->SetReg(dstReg_, data_);
-
-	execMan.enqueue(tmpState);
+	tmpState.SetReg(dstReg_, data_);
 }
 
 // FI_move_reg
-void FI_move_reg::execute(ExecutionManager& execMan, SymState& state)
+void FI_move_reg::assign(const SymState& /* state */, SymState& tmpState) const
 {
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-	tmpState->SetReg(dstReg_, tmpState->GetReg(src_));
-
-	execMan.enqueue(tmpState);
+	tmpState.SetReg(dstReg_, tmpState.GetReg(src_));
 }
 
 // FI_bnot
-void FI_bnot::execute(ExecutionManager& execMan, SymState& state)
+void FI_bnot::assign(const SymState& /* state */, SymState& tmpState) const
 {
 	// Assertions
-	assert(state.GetReg(dstReg_).isBool());
+	assert(tmpState.GetReg(dstReg_).isBool());
 
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-	tmpState->SetReg(dstReg_, Data::createBool(!tmpState->GetReg(dstReg_).d_bool));
-
-	execMan.enqueue(tmpState);
+	tmpState.SetReg(dstReg_, Data::createBool(!tmpState.GetReg(dstReg_).d_bool));
 }
 
 // FI_inot
-void FI_inot::execute(ExecutionManager& execMan, SymState& state)
+void FI_inot::assign(const SymState& /* state */, SymState& tmpState) const
 {
 	// Assertions
-	assert(state.GetReg(dstReg_).isInt());
+	assert(tmpState.GetReg(dstReg_).isInt());
 
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-	tmpState->SetReg(dstReg_, Data::createBool(!tmpState->GetReg(dstReg_).d_int));
-
-	execMan.enqueue(tmpState);
+	tmpState.SetReg(dstReg_, Data::createBool(!tmpState.GetReg(dstReg_).d_int));
 }
 
 // FI_move_reg_offs
-void FI_move_reg_offs::execute(ExecutionManager& execMan, SymState& state)
+void FI_move_reg_offs::assign(const SymState& state, SymState& tmpState) const
 {
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-	Data data = tmpState->GetReg(src_);
+	Data data = tmpState.GetReg(src_);
 
 	if (!data.isRef())
 	{
 		std::stringstream ss;
 		ss << "dereferenced value is not a valid reference [" << data << ']';
-		throw ProgramError(ss.str(), &state, getLoc(state));
+		throw ProgramError(ss.str(), &state, getLoc(*this));
 	}
 
 	data.d_ref.displ += offset_;
 
-	tmpState->SetReg(dstReg_, data);
-
-	execMan.enqueue(tmpState);
+	tmpState.SetReg(dstReg_, data);
 }
 
 // FI_move_reg_inc
-void FI_move_reg_inc::execute(ExecutionManager& execMan, SymState& state)
+void FI_move_reg_inc::assign(const SymState& state, SymState& tmpState) const
 {
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-	Data data = tmpState->GetReg(src1_);
+	Data data = tmpState.GetReg(src1_);
 
 	if (!data.isRef())
 	{
 		std::stringstream ss;
 		ss << "dereferenced value is not a valid reference [" << data << ']';
-		throw ProgramError(ss.str(), &state, getLoc(state));
+		throw ProgramError(ss.str(), &state, getLoc(*this));
 	}
 
 	// make sure that the value is really integer
-	assert(tmpState->GetReg(src2_).isInt());
-
-	data.d_ref.displ += tmpState->GetReg(src2_).d_int;
-	tmpState->SetReg(dstReg_, data);
+	assert(tmpState.GetReg(src2_).isInt());
 
-	execMan.enqueue(tmpState);
+	data.d_ref.displ += tmpState.GetReg(src2_).d_int;
+	tmpState.SetReg(dstReg_, data);
 }
 
 // FI_get_greg
-void FI_get_greg::execute(ExecutionManager& execMan, SymState& state)
+void FI_get_greg::assign(const SymState& /* state */, SymState& tmpState) const
 {
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-
-	tmpState->SetReg(dstReg_, VirtualMachine(*(tmpState->GetFAE())).varGet(src_));
-
-	execMan.enqueue(tmpState);
+	tmpState.SetReg(dstReg_, VirtualMachine(*(tmpState.GetFAE())).varGet(src_));
 }
 
 // FI_set_greg
@@ -278,67 +264,54 @@ void FI_set_greg::execute(ExecutionManager& execMan, SymState& state)
 }
 
 // FI_get_ABP
-void FI_get_ABP::execute(ExecutionManager& execMan, SymState& state)
+void FI_get_ABP::assign(const SymState& /* state */, SymState& tmpState) const
 {
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-	Data data = VirtualMachine(*(tmpState->GetFAE())).varGet(ABP_INDEX);
+	Data data = VirtualMachine(*(tmpState.GetFAE())).varGet(ABP_INDEX);
 	data.d_ref.displ += offset_;
 
-	tmpState->SetReg(dstReg_, data);
-
-	execMan.enqueue(tmpState);
+	tmpState.SetReg(dstReg_, data);
 }
 
 // FI_get_GLOB
-void FI_get_GLOB::execute(ExecutionManager& execMan, SymState& state)
+void FI_get_GLOB::assign(const SymState& /* state */, SymState& tmpState) const
 {
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-	Data data = VirtualMachine(*(tmpState->GetFAE())).varGet(GLOB_INDEX);
+	Data data = VirtualMachine(*(tmpState.GetFAE())).varGet(GLOB_INDEX);
 	data.d_ref.displ += offset_;
 
-	tmpState->SetReg(dstReg_, data);
-
-	execMan.enqueue(tmpState);
+	tmpState.SetReg(dstReg_, data);
 }
 
 // FI_load
-void FI_load::execute(ExecutionManager& execMan, SymState& state)
+void FI_load::assign(const SymState& /* state */, SymState& tmpState) const
 {
 	// Assertions
-	assert(state.GetReg(src_).isRef());
-
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
+	assert(tmpState.GetReg(src_).isRef());
 
-	Data data = tmpState->GetReg(src_);
+	Data data = tmpState.GetReg(src_);
 
 	Data out;
-	VirtualMachine(*(tmpState->GetFAE())).nodeLookup(
+	VirtualMachine(*(tmpState.GetFAE())).nodeLookup(
 		data.d_ref.root, data.d_ref.displ + offset_, out
 	);
 
-	tmpState->SetReg(dstReg_, out);
-
-	execMan.enqueue(tmpState);
+	tmpState.SetReg(dstReg_, out);
 }
 
 // FI_load_ABP
-void FI_load_ABP::execute(ExecutionManager& execMan, SymState& state)
+void FI_load_ABP::assign(const SymState& /* state */, SymState& tmpState) const
 {
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-	VirtualMachine vm(*(tmpState->GetFAE()));
+	VirtualMachine vm(*(tmpState.GetFAE()));
 
 	Data data = vm.varGet(ABP_INDEX);
 	Data out;
 	vm.nodeLookup(data.d_ref.root, static_cast<size_t>(offset_), out);
-	tmpState->SetReg(dstReg_, out);
-	execMan.enqueue(tmpState);
+	tmpState.SetReg(dstReg_, out);
 }
 
 // FI_load_GLOB
-void FI_load_GLOB::execute(ExecutionManager& execMan, SymState& state)
+void FI_load_GLOB::assign(const SymState& /* state */, SymState& tmpState) const
 {
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-	VirtualMachine vm(*(tmpState->GetFAE()));
+	VirtualMachine vm(*(tmpState.GetFAE()));
 
 	Data data = vm.varGet(GLOB_INDEX);
 	// make sure that the value is really a tree reference
@@ -346,9 +319,7 @@ void FI_load_GLOB::execute(ExecutionManager& execMan, SymState& state)
 
 	Data out;
 	vm.nodeLookup(data.d_ref.root, static_cast<size_t>(offset_), out);
-	tmpState->SetReg(dstReg_, out);
-
-	execMan.enqueue(tmpState);
+	tmpState.SetReg(dstReg_, out);
 }
 
 // FI_store
@@ -376,22 +347,20 @@ void FI_store::execute(ExecutionManager& execMan, SymState& state)
 }
 
 // FI_loads
-void FI_loads::execute(ExecutionManager& execMan, SymState& state)
+void FI_loads::assign(const SymState& /* state */, SymState& tmpState) const
 {
 	// Assertions
-	assert(state.GetReg(src_).isRef());
+	assert(tmpState.GetReg(src_).isRef());
 
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-	const Data& data = tmpState->GetReg(src_);
+	const Data& data = tmpState.GetReg(src_);
 
 	Data out;
-	VirtualMachine(*(tmpState->GetFAE())).nodeLookupMultiple(
+	VirtualMachine(*(tmpState.GetFAE())).nodeLookupMultiple(
 		data.d_ref.root, data.d_ref.displ + base_, offsets_,
 		out
 	);
 
-	tmpState->SetReg(dstReg_, out);
-	execMan.enqueue(tmpState);
+	tmpState.SetReg(dstReg_, out);
 }
 
 // FI_stores
@@ -515,15 +484,22 @@ void FI_node_free::execute(ExecutionManager& execMan, SymState& state)
 }
 
 // FI_iadd
-void FI_iadd::execute(ExecutionManager& execMan, SymState& state)
+void FI_iadd::assign(const SymState& /* state */, SymState& tmpState) const
 {
 	// Assertions
-	assert(state.GetReg(src1_).isInt() && state.GetReg(src2_).isInt());
+	assert(tmpState.GetReg(src1_).isInt() && tmpState.GetReg(src2_).isInt());
 
+	int sum = tmpState.GetReg(src1_).d_int + tmpState.GetReg(src2_).d_int;
+	tmpState.SetReg(dstReg_, Data::createInt((sum > 0)? 1 : 0));
+}
+
+// FI_assign_seq
+void FI_assign_seq::execute(ExecutionManager& execMan, SymState& state)
+{
 	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
 
-	int sum = tmpState->GetReg(src1_).d_int + tmpState->GetReg(src2_).d_int;
-	tmpState->SetReg(dstReg_, Data::createInt((sum > 0)? 1 : 0));
+	for (const PureAssignment* instr : seq_)
+		instr->assign(state, *tmpState);
 
 	execMan.enqueue(tmpState);
 }
@@ -561,20 +537,16 @@ void FI_abort::execute(ExecutionManager& execMan, SymState& state)
 }
 
 // FI_build_struct
-void FI_build_struct::execute(ExecutionManager& execMan, SymState& state)
+void FI_build_struct::assign(const SymState& /* state */, SymState& tmpState) const
 {
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-
 	std::vector<Data::item_info> items;
 
 	for (size_t i = 0; i < offsets_.size(); ++i)
 	{
-		items.push_back(std::make_pair(offsets_[i], tmpState->GetReg(start_ + i)));
+		items.push_back(std::make_pair(offsets_[i], tmpState.GetReg(start_ + i)));
 	}
 
-	tmpState->SetReg(dstReg_, Data::createStruct(items));
-
-	execMan.enqueue(tmpState);
+	tmpState.SetReg(dstReg_, Data::createStruct(items));
 }
 
 // FI_push_greg
@@ -78,6 +78,28 @@ public:
 	{
 		return os << "cjmp  \tr" << src_ << ", " << next_[0] << ", " << next_[1];
 	}
+
+	/**
+	 * @brief  Gets the register with the condition
+	 *
+	 * @returns  Index of the register with the Boolean value
+	 */
+	size_t src() const { return src_; }
+
+	/**
+	 * @brief  Gets a successor of the conditional jump
+	 *
+	 * @param[in]  i  0 for the @p if block, 1 for the @p else block
+	 *
+	 * @returns  The instruction the jump continues with
+	 */
+	AbstractInstruction* branch(size_t i) const { return next_[i]; }
+
+	virtual void successors(std::vector<const AbstractInstruction*>& dst) const
+	{
+		dst.push_back(next_[0]);
+		dst.push_back(next_[1]);
+	}
 };
 
 
@@ -180,7 +202,7 @@ public:
 /**
  * @brief  Loads a constant into a register
  */
-class FI_load_cst : public RegisterAssignment
+class FI_load_cst : public PureAssignment
 {
 	/// The data value to be loaded into the register denoted by @p dst_
 	Data data_;
@@ -188,20 +210,27 @@ class FI_load_cst : public RegisterAssignment
 public:
 
 	FI_load_cst(const CodeStorage::Insn* insn, size_t dst, const Data& data)
-		: RegisterAssignment(insn, dst), data_(data) {}
+		: PureAssignment(insn, dst), data_(data) {}
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(const SymState& state, SymState& tmpState) const;
+
+	virtual bool isRemovable() const { return true; }
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "mov   \tr" << this->dstReg_ << ", " << this->data_;
 	}
 
+	virtual void returnAddresses(std::vector<const AbstractInstruction*>& dst) const {
+		if (this->data_.isNativePtr())
+			dst.push_back(static_cast<const AbstractInstruction*>(this->data_.d_native_ptr));
+	}
+
 };
 
 /**
  * @brief  Moves a value between two registers
  */
-class FI_move_reg : public RegisterAssignment
+class FI_move_reg : public PureAssignment
 {
 	/// Index of the source register
 	size_t src_;
@@ -209,13 +238,19 @@ class FI_move_reg : public RegisterAssignment
 public:
 
 	FI_move_reg(const CodeStorage::Insn* insn, size_t dst, size_t src)
-		: RegisterAssignment(insn, dst), src_(src)
+		: PureAssignment(insn, dst), src_(src)
 	{
 		// Check that we don't make a useless move
 		assert(src_ != dstReg_);
 	}
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(const SymState& state, SymState& tmpState) const;
+
+	virtual bool isRemovable() const { return true; }
+
+	virtual void usedRegs(std::vector<size_t>& regs) const {
+		regs.push_back(this->src_);
+	}
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "mov   \tr" << this->dstReg_ << ", r" << this->src_;
@@ -226,14 +261,18 @@ public:
 /**
  * @brief  Negates a Boolean value in a register
  */
-class FI_bnot : public RegisterAssignment
+class FI_bnot : public PureAssignment
 {
 public:
 
 	FI_bnot(const CodeStorage::Insn* insn, size_t dst)
-		: RegisterAssignment(insn, dst) { }
+		: PureAssignment(insn, dst) { }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(const SymState& state, SymState& tmpState) const;
+
+	virtual void usedRegs(std::vector<size_t>& regs) const {
+		regs.push_back(this->dstReg_);
+	}
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "not   \tr" << this->dstReg_;
@@ -246,14 +285,18 @@ public:
  *
  * Negates an integer value in a register: the result is a Boolean.
  */
-class FI_inot : public RegisterAssignment
+class FI_inot : public PureAssignment
 {
 public:
 
 	FI_inot(const CodeStorage::Insn* insn, size_t dst) :
-		RegisterAssignment(insn, dst) { }
+		PureAssignment(insn, dst) { }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(const SymState& state, SymState& tmpState) const;
+
+	virtual void usedRegs(std::vector<size_t>& regs) const {
+		regs.push_back(this->dstReg_);
+	}
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "not   \tr" << this->dstReg_;
@@ -268,7 +311,7 @@ public:
  * register. Before storing the reference into the target register, the
  * displacement is incremented by a specified offset.
  */
-class FI_move_reg_offs : public RegisterAssignment
+class FI_move_reg_offs : public PureAssignment
 {
 	/// Index of the source register
 	size_t src_;
@@ -280,10 +323,14 @@ public:
 
 	FI_move_reg_offs(const CodeStorage::Insn* insn,
 		size_t dst, size_t src, int offset)
-		: RegisterAssignment(insn, dst), src_(src), offset_(offset)
+		: PureAssignment(insn, dst), src_(src), offset_(offset)
 	{ }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(const SymState& state, SymState& tmpState) const;
+
+	virtual void usedRegs(std::vector<size_t>& regs) const {
+		regs.push_back(this->src_);
+	}
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "mov   \tr" << this->dstReg_ << ", r" << this->src_
@@ -299,7 +346,7 @@ public:
  * register. Before storing the reference into the target register, the
  * displacement is incremented by the value in the specified register.
  */
-class FI_move_reg_inc : public RegisterAssignment
+class FI_move_reg_inc : public PureAssignment
 {
 	/// Index of the source register
 	size_t src1_;
@@ -311,10 +358,15 @@ public:
 
 	FI_move_reg_inc(const CodeStorage::Insn* insn,
 		size_t dst, size_t src1, size_t src2)
-		: RegisterAssignment(insn, dst), src1_(src1), src2_(src2)
+		: PureAssignment(insn, dst), src1_(src1), src2_(src2)
 	{ }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(const SymState& state, SymState& tmpState) const;
+
+	virtual void usedRegs(std::vector<size_t>& regs) const {
+		regs.push_back(this->src1_);
+		regs.push_back(this->src2_);
+	}
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "mov   \tr" << this->dstReg_ << ", r" << this->src1_
@@ -328,7 +380,7 @@ public:
  *
  * Loads the value from a global register into a local register.
  */
-class FI_get_greg : public RegisterAssignment
+class FI_get_greg : public PureAssignment
 {
 	/// Index of the source global register
 	size_t src_;
@@ -336,9 +388,9 @@ class FI_get_greg : public RegisterAssignment
 public:
 
 	FI_get_greg(const CodeStorage::Insn* insn, size_t dst, size_t src)
-		: RegisterAssignment(insn, dst), src_(src) { }
+		: PureAssignment(insn, dst), src_(src) { }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(const SymState& state, SymState& tmpState) const;
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "mov   \tr" << this->dstReg_ << ", gr" << this->src_;
@@ -382,7 +434,7 @@ public:
  *
  * Loads the ABP pointer incremented by the specified offset into a register.
  */
-class FI_get_ABP : public RegisterAssignment
+class FI_get_ABP : public PureAssignment
 {
 	/// Offset to be added to the loaded pointer
 	int offset_;
@@ -390,9 +442,11 @@ class FI_get_ABP : public RegisterAssignment
 public:
 
 	FI_get_ABP(const CodeStorage::Insn* insn, size_t dst, int offset)
-		: RegisterAssignment(insn, dst), offset_(offset) { }
+		: PureAssignment(insn, dst), offset_(offset) { }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(const SymState& state, SymState& tmpState) const;
+
+	virtual bool isRemovable() const { return true; }
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "mov   \tr" << this->dstReg_ << ", ABP + " << this->offset_;
@@ -405,7 +459,7 @@ public:
  *
  * Loads the GLOB pointer incremented by the specified offset into a register.
  */
-class FI_get_GLOB : public RegisterAssignment
+class FI_get_GLOB : public PureAssignment
 {
 	/// Offset to be added to the loaded pointer
 	int offset_;
@@ -413,9 +467,11 @@ class FI_get_GLOB : public RegisterAssignment
 public:
 
 	FI_get_GLOB(const CodeStorage::Insn* insn, size_t dst, int offset)
-		: RegisterAssignment(insn, dst),  offset_(offset) { }
+		: PureAssignment(insn, dst),  offset_(offset) { }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(const SymState& state, SymState& tmpState) const;
+
+	virtual bool isRemovable() const { return true; }
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "mov   \tr" << this->dstReg_ << ", GLOB + " << this->offset_;
@@ -429,7 +485,7 @@ public:
  * Loads a value at a given @p offset_ from the location pointed by the @p src_
  * register into the @p dst_ register.
  */
-class FI_load : public RegisterAssignment
+class FI_load : public PureAssignment
 {
 	/// Index of the source register
 	size_t src_;
@@ -440,10 +496,14 @@ class FI_load : public RegisterAssignment
 public:
 
 	FI_load(const CodeStorage::Insn* insn, size_t dst, size_t src, int offset)
-		: RegisterAssignment(insn, dst), src_(src), offset_(offset)
+		: PureAssignment(insn, dst), src_(src), offset_(offset)
 	{ }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(const SymState& state, SymState& tmpState) const;
+
+	virtual void usedRegs(std::vector<size_t>& regs) const {
+		regs.push_back(this->src_);
+	}
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "mov   \tr" << this->dstReg_ << ", [r" << this->src_
@@ -458,7 +518,7 @@ public:
  * Loads a value which is at the specified offset from the location pointed by
  * the ABP pointer into a register.
  */
-class FI_load_ABP : public RegisterAssignment
+class FI_load_ABP : public PureAssignment
 {
 	/// Offset from the ABP 
 	int offset_;
@@ -466,9 +526,9 @@ class FI_load_ABP : public RegisterAssignment
 public:
 
 	FI_load_ABP(const CodeStorage::Insn* insn, size_t dst, int offset)
-		: RegisterAssignment(insn, dst), offset_(offset) { }
+		: PureAssignment(insn, dst), offset_(offset) { }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(const SymState& state, SymState& tmpState) const;
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "mov   \tr" << this->dstReg_ << ", [ABP + " << this->offset_ << ']';
@@ -482,7 +542,7 @@ public:
  * Loads a value which is at the specified offset from the location pointed by
  * the GLOB pointer into a register.
  */
-class FI_load_GLOB : public RegisterAssignment
+class FI_load_GLOB : public PureAssignment
 {
 	/// Offset from the GLOB
 	int offset_;
@@ -490,9 +550,9 @@ class FI_load_GLOB : public RegisterAssignment
 public:
 
 	FI_load_GLOB(const CodeStorage::Insn* insn, size_t dst, int offset)
-		: RegisterAssignment(insn, dst), offset_(offset) { }
+		: PureAssignment(insn, dst), offset_(offset) { }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(const SymState& state, SymState& tmpState) const;
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "mov   \tr" << this->dstReg_ << ", [GLOB + " << this->offset_ << ']';
@@ -547,7 +607,7 @@ public:
  * Loads a structure with multiple offsets pointed by the @p src_ register into
  * the @p dst_ register.
  */
-class FI_loads : public RegisterAssignment
+class FI_loads : public PureAssignment
 {
 	/// Index of the source register
 	size_t src_;
@@ -562,11 +622,15 @@ public:
 
 	FI_loads(const CodeStorage::Insn* insn, size_t dst, size_t src, int base,
 		const std::vector<size_t>& offsets) :
-		RegisterAssignment(insn, dst), src_(src), base_(base),
+		PureAssignment(insn, dst), src_(src), base_(base),
 		offsets_(offsets)
 	{ }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(const SymState& state, SymState& tmpState) const;
+
+	virtual void usedRegs(std::vector<size_t>& regs) const {
+		regs.push_back(this->src_);
+	}
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "mov   \tr" << this->dstReg_ << ", [r" << this->src_ << " + "
@@ -744,7 +808,7 @@ public:
 /**
  * @brief  Computes integer addition
  */
-class FI_iadd : public RegisterAssignment
+class FI_iadd : public PureAssignment
 {
 	/// Index of the register with the first operand
 	size_t src1_;
@@ -755,10 +819,15 @@ class FI_iadd : public RegisterAssignment
 public:
 
 	FI_iadd(const CodeStorage::Insn* insn, size_t dst, size_t src1, size_t src2)
-		: RegisterAssignment(insn, dst), src1_(src1), src2_(src2)
+		: PureAssignment(insn, dst), src1_(src1), src2_(src2)
 	{ }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(const SymState& state, SymState& tmpState) const;
+
+	virtual void usedRegs(std::vector<size_t>& regs) const {
+		regs.push_back(this->src1_);
+		regs.push_back(this->src2_);
+	}
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "iadd  \tr" << this->dstReg_ << ", r" << this->src1_
@@ -848,7 +917,7 @@ public:
  * Builds a memory structure (e.g. a stack frame) from registers' content
  * (starting from the @p start_ register.
  */
-class FI_build_struct : public RegisterAssignment
+class FI_build_struct : public PureAssignment
 {
 	/// Index of the starting register
 	size_t start_;
@@ -860,9 +929,16 @@ public:
 
 	FI_build_struct(const CodeStorage::Insn* insn, size_t dst, size_t start,
 		const std::vector<size_t>& offsets) :
-		RegisterAssignment(insn, dst), start_(start), offsets_(offsets) { }
+		PureAssignment(insn, dst), start_(start), offsets_(offsets) { }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(const SymState& state, SymState& tmpState) const;
+
+	virtual bool isRemovable() const { return true; }
+
+	virtual void usedRegs(std::vector<size_t>& regs) const {
+		for (size_t i = 0; i < this->offsets_.size(); ++i)
+			regs.push_back(this->start_ + i);
+	}
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		os << "mov   \tr" << this->dstReg_ << ", {";
@@ -933,6 +1009,61 @@ public:
 
 };
 
+/**
+ * @brief  A sequence of pure register assignments
+ *
+ * Super-instruction created by the optimiser of the microcode from a sequence
+ * of pure instructions (see PureAssignment) of a single
+ * instruction in the code storage. The whole sequence is performed within
+ * a single child state.
+ */
+class FI_assign_seq : public SequentialInstruction
+{
+	/// The fused instructions (owned by this instruction)
+	std::vector<PureAssignment*> seq_;
+
+private:  // methods
+
+	FI_assign_seq(const FI_assign_seq&);
+	FI_assign_seq& operator=(const FI_assign_seq&);
+
+public:
+
+	explicit FI_assign_seq(const std::vector<PureAssignment*>& seq) :
+		SequentialInstruction(seq.front()->insn()),
+		seq_(seq)
+	{ }
+
+	virtual ~FI_assign_seq()
+	{
+		for (auto instr : seq_)
+			delete instr;
+	}
+
+	virtual void execute(ExecutionManager& execMan, SymState& state);
+
+	virtual SymState* reverseAndIsect(
+		ExecutionManager&                      execMan,
+		const SymState&                        fwdPred,
+		const SymState&                        bwdSucc) const;
+
+	virtual std::ostream& toStream(std::ostream& os) const {
+		const char* sep = "{ ";
+		for (const PureAssignment* instr : seq_) {
+			os << sep << *instr;
+			sep = "; ";
+		}
+
+		return os << " }";
+	}
+
+	virtual void returnAddresses(std::vector<const AbstractInstruction*>& dst) const {
+		for (const PureAssignment* instr : seq_)
+			instr->returnAddresses(dst);
+	}
+
+};
+
 /**
  * @brief  Prints the heap
  *
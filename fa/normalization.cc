@@ -202,8 +202,8 @@ void Normalization::normalizeRoot(
 			refStates
 		);
 
-		this->fae.setRoot(root, std::shared_ptr<TreeAut>(ta));
-		this->fae.setRoot(cutpoint.root, nullptr);
+		this->fae.replaceRoot(root, std::shared_ptr<TreeAut>(ta));
+		this->fae.replaceRoot(cutpoint.root, nullptr);
 
 		this->fae.connectionGraph.mergeCutpoint(root, cutpoint.root);
 	}
@@ -326,7 +326,7 @@ bool Normalization::normalize(
 
 	for (size_t i = 0; i < this->fae.getRootCount(); ++i)
 	{
-		this->fae.setRoot(i, std::shared_ptr<TreeAut>(
+		this->fae.replaceRoot(i, std::shared_ptr<TreeAut>(
 			this->fae.relabelReferences(this->fae.getRoot(i).get(), index)
 		));
 	}
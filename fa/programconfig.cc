@@ -43,6 +43,20 @@ void ProgramConfig::processArg(const std::string& arg)
 		return;
 	}
 
+	if (std::string("print-ucode-unopt") == key)
+	{
+		this->printUcodeUnopt = true;
+		FA_LOG("Config::processArg: \"print-ucode-unopt\" mode requested");
+		return;
+	}
+
+	if (std::string("no-ucode-opt") == key)
+	{
+		this->optimizeUcode = false;
+		FA_LOG("Config::processArg: \"no-ucode-opt\" mode requested");
+		return;
+	}
+
 	if (std::string("print-orig-code") == key)
 	{
 		this->printOrigCode = true;
@@ -84,5 +98,42 @@ void ProgramConfig::processArg(const std::string& arg)
 		return;
 	}
 
+	if (std::string("box-db") == key)
+	{
+		if (data.size() < 2)
+		{
+			throw std::invalid_argument("use \"box-db:<file>\"");
+		}
+
+		// the file name may contain colons
+		this->boxDb = arg.substr(key.size() + 1);
+		FA_LOG("Config::processArg: \"box-db\" is \"" + this->boxDb + "\"");
+		return;
+	}
+
+	if (std::string("explore") == key)
+	{
+		if (data.size() != 2)
+		{
+			throw std::invalid_argument(
+				"use \"explore:<dfs|bfs|fixpoint|delay-fix>\"");
+		}
+
+		if (std::string("dfs") == data[1])
+			this->explore = explore_e::eDFS;
+		else if (std::string("bfs") == data[1])
+			this->explore = explore_e::eBFS;
+		else if (std::string("fixpoint") == data[1])
+			this->explore = explore_e::eFixpoint;
+		else if (std::string("delay-fix") == data[1])
+			this->explore = explore_e::eDelayFix;
+		else
+			throw std::invalid_argument("unknown exploration strategy \""
+				+ data[1] + "\"");
+
+		FA_LOG("Config::processArg: \"explore\" is \"" + data[1] + "\"");
+		return;
+	}
+
 	FA_WARN("unhandled argument: \"" << arg << "\"");
 }
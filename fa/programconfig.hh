@@ -26,16 +26,29 @@
 // Forester headers
 #include "streams.hh"
 
+/// the order in which the symbolic states are explored
+enum class explore_e
+{
+	eDFS,         ///< depth-first
+	eBFS,         ///< breadth-first
+	eFixpoint,    ///< the states closest to a fixpoint instruction first
+	eDelayFix     ///< depth-first, the states at fixpoint instructions last
+};
+
 struct ProgramConfig
 {
 public:   // data members
 
 	std::string dbRoot;             ///< box database root directory
+	std::string boxDb;              ///< file to import/export learned boxes
 	bool        printUcode;         ///< printing microcode?
+	bool        printUcodeUnopt;    ///< printing microcode before optimisation?
+	bool        optimizeUcode;      ///< optimising microcode?
 	bool        printOrigCode;      ///< printing the original code?
 	bool        onlyCompile;        ///< only compiling?
 	bool        printTrace;         ///< printing trace for errors?
 	bool        printUcodeTrace;    ///< printing microcode trace for errors?
+	explore_e   explore;            ///< the order of exploring states
 
 private:  // methods
 
@@ -45,11 +58,15 @@ public:   // methods
 
 	ProgramConfig(const std::string& confStr = "") :
 		dbRoot(""),
+		boxDb(""),
 		printUcode(false),
+		printUcodeUnopt(false),
+		optimizeUcode(true),
 		printOrigCode(false),
 		onlyCompile(false),
 		printTrace(false),
-		printUcodeTrace(false)
+		printUcodeTrace(false),
+		explore(explore_e::eDFS)
 	{
 		std::vector<std::string> args;
 		boost::split(args, confStr, boost::is_any_of(";"));
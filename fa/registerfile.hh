@@ -0,0 +1,218 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef REGISTER_FILE_H
+#define REGISTER_FILE_H
+
+/**
+ * @file registerfile.hh
+ * RegisterFile - copy-on-write array of registers of symbolic states
+ */
+
+// Standard library headers
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <vector>
+
+// Forester headers
+#include "types.hh"
+
+/**
+ * @brief  The register file of a symbolic state
+ *
+ * An array of @p Data values split into chunks of a fixed size, which are
+ * shared among the copies of the array.  A chunk is copied on the first write
+ * into it through a copy that shares it.  Hence, copying the array costs only
+ * a vector of pointers and a write copies a single chunk.  In particular, the
+ * nested data of structures are not copied for the unchanged registers.
+ */
+class RegisterFile
+{
+private:  // data types
+
+	/// The number of values in a chunk
+	enum { CHUNK_SIZE = 8 };
+
+	typedef std::vector<Data> Chunk;
+
+	typedef std::vector<std::shared_ptr<Chunk>> ChunkVector;
+
+private:  // data members
+
+	/// The chunks of the array, the last one may be smaller than the others
+	ChunkVector chunks_;
+
+	/// The number of values in the array
+	size_t size_;
+
+public:   // data types
+
+	/**
+	 * @brief  Iterator over the values of the array
+	 */
+	class const_iterator
+	{
+	private:  // data members
+
+		const RegisterFile* array_;
+		size_t index_;
+
+	public:   // methods
+
+		const_iterator(const RegisterFile* array, size_t index) :
+			array_(array),
+			index_(index)
+		{ }
+
+		const Data& operator*() const { return (*array_)[index_]; }
+
+		const Data* operator->() const { return &(*array_)[index_]; }
+
+		const_iterator& operator++()
+		{
+			++index_;
+			return *this;
+		}
+
+		bool operator==(const const_iterator& rhs) const
+		{
+			return (array_ == rhs.array_) && (index_ == rhs.index_);
+		}
+
+		bool operator!=(const const_iterator& rhs) const
+		{
+			return !(*this == rhs);
+		}
+	};
+
+public:   // methods
+
+	/**
+	 * @brief  Constructor
+	 *
+	 * Creates an array of @p size copies of @p data.
+	 *
+	 * @param[in]  size  The number of values
+	 * @param[in]  data  The initial value
+	 */
+	explicit RegisterFile(
+		size_t               size = 0,
+		const Data&          data = Data()) :
+		chunks_{},
+		size_(size)
+	{
+		for (size_t i = 0; i < size; i += CHUNK_SIZE)
+		{
+			const size_t len = std::min<size_t>(CHUNK_SIZE, size - i);
+			chunks_.push_back(std::make_shared<Chunk>(len, data));
+		}
+	}
+
+	size_t size() const { return size_; }
+
+	bool empty() const { return 0 == size_; }
+
+	const Data& operator[](size_t index) const
+	{
+		// Assertions
+		assert(index < size_);
+
+		return (*chunks_[index / CHUNK_SIZE])[index % CHUNK_SIZE];
+	}
+
+	/**
+	 * @brief  Sets the value at the given index
+	 *
+	 * Sets the value at @p index, copying the chunk of the value first if it
+	 * is shared with another array.
+	 *
+	 * @param[in]  index  Index of the value
+	 * @param[in]  data   The new value
+	 */
+	void set(size_t index, const Data& data)
+	{
+		this->writableAt(index) = data;
+	}
+
+	/**
+	 * @copydoc set(size_t, const Data&)
+	 */
+	void set(size_t index, Data&& data)
+	{
+		this->writableAt(index) = std::move(data);
+	}
+
+	/**
+	 * @brief  Releases all values of the array
+	 */
+	void clear()
+	{
+		chunks_.clear();
+		size_ = 0;
+	}
+
+	const_iterator begin() const { return const_iterator(this, 0); }
+
+	const_iterator end() const { return const_iterator(this, size_); }
+
+	bool operator==(const RegisterFile& rhs) const
+	{
+		if (size_ != rhs.size_)
+			return false;
+
+		for (size_t i = 0; i < chunks_.size(); ++i)
+		{
+			if ((chunks_[i] != rhs.chunks_[i]) && (*chunks_[i] != *rhs.chunks_[i]))
+				return false;
+		}
+
+		return true;
+	}
+
+	bool operator!=(const RegisterFile& rhs) const
+	{
+		return !(*this == rhs);
+	}
+
+private:  // methods
+
+	/**
+	 * @brief  Gets a value that may be written
+	 *
+	 * Makes the chunk of the value at @p index private to this array first.
+	 *
+	 * @param[in]  index  Index of the value
+	 *
+	 * @returns  Reference to the value at @p index
+	 */
+	Data& writableAt(size_t index)
+	{
+		// Assertions
+		assert(index < size_);
+
+		std::shared_ptr<Chunk>& chunk = chunks_[index / CHUNK_SIZE];
+		if (!chunk.unique())
+			chunk = std::make_shared<Chunk>(*chunk);
+
+		return (*chunk)[index % CHUNK_SIZE];
+	}
+};
+
+#endif
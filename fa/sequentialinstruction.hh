@@ -82,6 +82,25 @@ public:
 	 * @returns  The next instruction in the sequence
 	 */
 	AbstractInstruction* next() const { return this->next_; }
+
+	/**
+	 * @brief  Sets the next instruction
+	 *
+	 * Method that redirects the instruction to a new successor. It is used by the
+	 * optimiser of the microcode after the code has been finalised.
+	 *
+	 * @param[in]  instr  The new next instruction in the sequence
+	 */
+	void next(AbstractInstruction* instr) { this->next_ = instr; }
+
+	/**
+	 * @copydoc AbstractInstruction::successors
+	 */
+	virtual void successors(std::vector<const AbstractInstruction*>& dst) const
+	{
+		if (this->next_)
+			dst.push_back(this->next_);
+	}
 };
 
 
@@ -107,14 +126,25 @@ protected:// methods
 	 *
 	 * @param[in]  insn    Corresponding instruction in the Code Storage
 	 * @param[in]  dstReg  The destination register of the instruction
+	 * @param[in]  fiType  The type of the instruction (from #fi_type_e)
 	 */
-	explicit RegisterAssignment(const CodeStorage::Insn* insn, size_t dstReg) :
-		SequentialInstruction(insn, fi_type_e::fiUnspec),
+	explicit RegisterAssignment(
+		const CodeStorage::Insn*               insn,
+		size_t                                 dstReg,
+		fi_type_e                              fiType = fi_type_e::fiUnspec) :
+		SequentialInstruction(insn, fiType),
 		dstReg_(dstReg)
 	{ }
 
 public:   // methods
 
+	/**
+	 * @brief  Gets the destination register
+	 *
+	 * @returns  Index of the destination register of the instruction
+	 */
+	size_t dstReg() const { return this->dstReg_; }
+
 	/**
 	 * @copydoc  AbstractInstruction::reverseAndIsect
 	 */
@@ -125,6 +155,72 @@ public:   // methods
 };
 
 
+/**
+ * @brief  Pure assignment into a local register
+ *
+ * A pure instruction only computes the value of its destination register from
+ * the registers and the heap, i.e. it neither modifies the heap nor splits the
+ * state. Sequences of pure instructions can be fused into a single instruction
+ * by the optimiser of the microcode.
+ */
+class PureAssignment : public RegisterAssignment
+{
+protected:// methods
+
+	/**
+	 * @brief  Constructor
+	 *
+	 * Creates a pure register assignment instruction for given instruction in
+	 * the Code Storage.
+	 *
+	 * @param[in]  insn    Corresponding instruction in the Code Storage
+	 * @param[in]  dstReg  The destination register of the instruction
+	 */
+	explicit PureAssignment(const CodeStorage::Insn* insn, size_t dstReg) :
+		RegisterAssignment(insn, dstReg)
+	{ }
+
+public:   // methods
+
+	/**
+	 * @brief  Executes the assignment in a child state
+	 *
+	 * Creates a child state with a new register file, performs assign() on it
+	 * and enqueues it.
+	 *
+	 * @copydetails  AbstractInstruction::execute
+	 */
+	virtual void execute(ExecutionManager& execMan, SymState& state);
+
+	/**
+	 * @brief  Performs the assignment on the registers of a state
+	 *
+	 * Stores the value computed by the instruction into the destination register
+	 * of @p tmpState.
+	 *
+	 * @param[in]      state     The state in which the instruction is executed,
+	 *                           used for reporting errors
+	 * @param[in,out]  tmpState  The state whose registers are to be updated
+	 */
+	virtual void assign(const SymState& state, SymState& tmpState) const = 0;
+
+	/**
+	 * @brief  Is the instruction safe to be removed?
+	 *
+	 * @returns  @p true if the instruction can never fail, so that it can be
+	 *           dropped once its result is overwritten
+	 */
+	virtual bool isRemovable() const { return false; }
+
+	/**
+	 * @brief  Collects the registers read by assign()
+	 *
+	 * @param[out]  regs  The vector the indices of the registers are appended to
+	 */
+	virtual void usedRegs(std::vector<size_t>& regs) const { (void)regs; }
+};
+
+
 /**
  * @brief  Instruction with void effect
  *
@@ -29,70 +29,77 @@
 #include "relation.hh"
 #include "lts.hh"
 
+/**
+ * @brief per-block counters of OLRTAlgorithm
+ *
+ * The row of each label is allocated on the first use and holds one counter
+ * per LTS::sources() of the label, indexed by LTS::key().  All the rows share
+ * a single contiguous array.
+ */
 class Counter {
 
-//	int _labels;
-//	int _states;
-	std::vector<std::vector<size_t> > _data;
-	const std::vector<std::vector<size_t> >* _key;
-	const std::vector<size_t>* _range;
-	
+	const LTS* _lts;
+	/// offset of the row of each label within _data, -1 if not allocated yet
+	std::vector<size_t> _offset;
+	std::vector<size_t> _data;
+
 private:  // methods
 
 	Counter& operator=(const Counter&);
 
+	static size_t none() {
+		return static_cast<size_t>(-1);
+	}
+
+	size_t* row(size_t label) {
+		if (this->_offset[label] == none()) {
+			this->_offset[label] = this->_data.size();
+			this->_data.resize(this->_data.size() + this->_lts->sources(label).size());
+		}
+		return &this->_data[this->_offset[label]];
+	}
+
 public:
 
-	Counter(size_t labels, const std::vector<std::vector<size_t> >& key, const std::vector<size_t>& range)
-		: _data(labels), _key(&key), _range(&range) {}
+	explicit Counter(const LTS& lts)
+		: _lts(&lts), _offset(lts.labels(), none()), _data() {}
 
 	Counter(const Counter& counter)
-		: _data(counter._data.size()), _key(counter._key), _range(counter._range) {}
-/*
-	void setKey(const std::vector<std::vector<int> >& key, const std::vector<int>& range) {
-		this->_key = &key;
-		this->_range = &range;
+		: _lts(counter._lts), _offset(counter._offset.size(), none()), _data() {}
+
+	bool isZero(size_t label, size_t key) const {
+		return (this->_offset[label] == none()) || (this->_data[this->_offset[label] + key] == 0);
 	}
-*/
-	bool isZero(size_t label, size_t state) const {
-		return (this->_data[label].size() == 0) || (this->_data[label][state] == 0);
+
+	size_t incr(size_t label, size_t key) {
+		return ++this->row(label)[key];
 	}
-	
-	size_t incr(size_t label, size_t state) {
-		if (this->_data[label].size() == 0)
-			this->_data[label].resize((*this->_range)[label]);
-		return ++this->_data[label][(*this->_key)[label][state]];
-	} 
-	
-	size_t decr(size_t label, size_t state) {
-		if ((*this->_key)[label][state] >= this->_data[label].size()) {
-			for (size_t a = 0; a < this->_key->size(); ++a) {
-				for (size_t i = 0; i < (*this->_key)[a].size(); ++i)
-					std::cout << (*this->_key)[a][i] << " ";
-				std::cout << "\n";
-			}
+
+	size_t decr(size_t label, size_t key) {
+		if (this->_offset[label] == none() || key >= this->_lts->sources(label).size()) {
 			this->dump();
 			throw std::runtime_error("Counter::decr() : location not allocated");
 		}
-		return --this->_data[label][(*this->_key)[label][state]];
+		return --this->_data[this->_offset[label] + key];
 	}
 
-	const std::vector<size_t>& getRow(size_t label) const {
-		return this->_data[label]; 
-	}
-	
 	void copyRow(size_t label, const Counter& c) {
-		this->_data[label] = c.getRow(label);
+		if (c._offset[label] == none()) {
+			if (this->_offset[label] != none())
+				std::fill_n(this->row(label), this->_lts->sources(label).size(), 0);
+			return;
+		}
+		std::copy_n(&c._data[c._offset[label]], this->_lts->sources(label).size(), this->row(label));
 	}
 
 	void dump() const {
-		for (std::vector<std::vector<size_t> >::const_iterator i = this->_data.begin(); i != this->_data.end(); ++i) {
-			if (i->size() > 0) {
-				std::cout << (i - this->_data.begin()) << ": ";
-				for (std::vector<size_t>::const_iterator j = i->begin(); j != i->end(); ++j)
-					std::cout << *j;
-				std::cout << std::endl;
-			}
+		for (size_t a = 0; a < this->_offset.size(); ++a) {
+			if (this->_offset[a] == none())
+				continue;
+			std::cout << a << ": ";
+			for (size_t i = 0; i < this->_lts->sources(a).size(); ++i)
+				std::cout << this->_data[this->_offset[a] + i];
+			std::cout << std::endl;
 		}
 	}
 
@@ -193,12 +200,12 @@ private:  // methods
 
 public:
 
-	OLRTBlock(size_t index, const LTS& lts, const std::vector<std::vector<size_t> >& key, const std::vector<size_t>& range)
-		: _index(index), _states(nullptr), _remove(lts.labels()), _counter(lts.labels(), key, range), _intersection(nullptr), _inset(lts.labels()), _tmp(nullptr) {
+	OLRTBlock(size_t index, const LTS& lts)
+		: _index(index), _states(nullptr), _remove(lts.labels()), _counter(lts), _intersection(nullptr), _inset(lts.labels()), _tmp(nullptr) {
 		for (size_t i = 0; i < lts.states(); ++i) {
 			new StateListElem(i, this, this->_states);
-			for (SmartSet::iterator j = lts.lPre()[i].begin(); j != lts.lPre()[i].end(); ++j)
-				this->_inset.add(*j);
+			for (size_t label : lts.lPre(i))
+				this->_inset.add(label);
 		}
 	}
 	
@@ -208,9 +215,9 @@ public:
 		parent->_intersection = this;
 		StateListElem* elem = this->_states;
 		do {
-			for (SmartSet::iterator i = lts.lPre()[elem->state()].begin(); i != lts.lPre()[elem->state()].end(); ++i) {
-				parent->_inset.remove(*i);
-				this->_inset.add(*i);
+			for (size_t label : lts.lPre(elem->state())) {
+				parent->_inset.remove(label);
+				this->_inset.add(label);
 			}
 			elem->block(this);
 			elem = elem->next();
@@ -307,10 +314,6 @@ class OLRTAlgorithm {
 	std::vector<StateListElem*> _index;
 	std::vector<std::pair<OLRTBlock*, size_t> > _queue;
 	std::vector<bool> _tmp;
-	std::vector<SmartSet> _delta;
-	std::vector<SmartSet> _delta1;
-	std::vector<std::vector<size_t> > _key;
-	std::vector<size_t> _range;
 	
 	std::vector<std::vector<size_t>*> _removeCache;
 	
@@ -419,8 +422,8 @@ protected:
 		this->split(*remove, removeList);
 		std::fill(this->_tmp.begin(), this->_tmp.end(), true);
 		for (std::vector<StateListElem*>::iterator i = prev.begin(); i != prev.end(); ++i) {
-			for (std::vector<size_t>::const_iterator j = this->_lts->dataPre()[label][(*i)->state()].begin(); j != this->_lts->dataPre()[label][(*i)->state()].end(); ++j) {
-				StateListElem* elem = this->_index[*j];
+			for (size_t j : this->_lts->pre((*i)->state(), label)) {
+				StateListElem* elem = this->_index[j];
 				OLRTBlock* block2 = elem->block();
 				if (this->_tmp[block2->index()]) {
 					this->_tmp[block2->index()] = false;
@@ -432,8 +435,10 @@ protected:
 								if (block2->inset().contains(*a)) {
 									StateListElem* elem2 = (*k)->states();
 									do {
-										for (std::vector<size_t>::const_iterator l = this->_lts->dataPre()[*a][elem2->state()].begin(); l != this->_lts->dataPre()[*a][elem2->state()].end(); ++l) {
-											if (!block2->counter().decr(*a, *l)) {
+										const LTS::Range pre = this->_lts->pre(elem2->state(), *a);
+										LTS::Range::const_iterator key = this->_lts->preKeys(elem2->state(), *a).begin();
+										for (LTS::Range::const_iterator l = pre.begin(); l != pre.end(); ++l, ++key) {
+											if (!block2->counter().decr(*a, *key)) {
 												if (!block2->remove()[*a]) {
 													block2->remove()[*a] = this->rcAlloc();
 													this->_queue.push_back(std::pair<OLRTBlock*, size_t>(block2, *a));
@@ -456,8 +461,9 @@ protected:
 public:
 
 	OLRTAlgorithm(const LTS& lts)
-		: _lts(&lts), _partition(), _relation(), _index{}, _queue{}, _tmp(lts.states()), _delta{}, _delta1{}, _key{}, _range{}, _removeCache() {
-		OLRTBlock* block = new OLRTBlock(this->_relation.newEntry(), lts, this->_key, this->_range);
+		: _lts(&lts), _partition(), _relation(), _index{}, _queue{}, _tmp(lts.states()), _removeCache() {
+		assert(lts.finalized());
+		OLRTBlock* block = new OLRTBlock(this->_relation.newEntry(), lts);
 		block->storeStates(this->_index);
 		this->_partition.push_back(block);
 	}
@@ -475,27 +481,17 @@ public:
 		this->_relation.reset();
 		this->_lts = &lts;
 		this->_tmp.resize(lts.states());
-		OLRTBlock* block = new OLRTBlock(this->_relation.newEntry(), lts, this->_key, this->_range);
+		assert(lts.finalized());
+		OLRTBlock* block = new OLRTBlock(this->_relation.newEntry(), lts);
 		block->storeStates(this->_index);
 		this->_partition.push_back(block);
 	}
 
 	void init() {
-		this->_lts->buildDelta(this->_delta, this->_delta1);
-		this->_key.resize(this->_lts->labels());
-		this->_range.resize(this->_lts->labels());
-		for (size_t a = 0; a < this->_lts->labels(); ++a) {
-			this->_key[a].resize(this->_lts->states());
-			this->_range[a] = this->_delta1[a].size();
-			size_t x = 0;
-			for (SmartSet::iterator i = this->_delta1[a].begin(); i != this->_delta1[a].end(); ++i)
-				this->_key[a][*i] = x++;
-		}
-		std::vector<size_t> tmp2;
 		for (size_t a = 0; a < this->_lts->labels(); ++a) {
 //			this->dump();
-			this->_delta1[a].buildVector(tmp2);
-			this->fastSplit(tmp2);
+			const LTS::Range src = this->_lts->sources(a);
+			this->fastSplit(std::vector<size_t>(src.begin(), src.end()));
 		}
 		std::vector<std::vector<bool> > tmp[2];
 		tmp[0].resize(this->_lts->labels(), std::vector<bool>(this->_partition.size(), true));
@@ -504,7 +500,7 @@ public:
 			for (std::vector<OLRTBlock*>::iterator i = this->_partition.begin(); i != this->_partition.end(); ++i) {
 				StateListElem* elem = (*i)->states();
 				do {
-					tmp[(this->_delta1[a].contains(elem->state()))?(1):(0)][a][(*i)->index()] = false;
+					tmp[(this->_lts->isSource(elem->state(), a))?(1):(0)][a][(*i)->index()] = false;
 					elem = elem->next();
 				} while (elem != (*i)->states());
 			}
@@ -519,25 +515,25 @@ public:
 				}
 			}			
 		}		
-		std::vector<std::vector<size_t> > post;
 //		for (std::vector<OLRTBlock*>::iterator i = this->_partition.begin(); i != this->_partition.end(); ++i) {
 		for (std::vector<OLRTBlock*>::reverse_iterator i = this->_partition.rbegin(); i != this->_partition.rend(); ++i) {
 			for (SmartSet::iterator j = (*i)->inset().begin(); j != (*i)->inset().end(); ++j) {
-				this->_lts->buildPost(*j, post);
-				for (SmartSet::iterator k = this->_delta1[*j].begin(); k != this->_delta1[*j].end(); ++k) {
-					for (std::vector<size_t>::iterator l = post[*k].begin(); l != post[*k].end(); ++l) {
-						if (this->_relation.data()[(*i)->index()][this->_index[*l]->block()->index()])
-							(*i)->counter().incr(*j, *k);
+				const LTS::Range src = this->_lts->sources(*j);
+				for (LTS::Range::const_iterator k = src.begin(); k != src.end(); ++k) {
+					for (size_t l : this->_lts->post(*k, *j)) {
+						if (this->_relation.data()[(*i)->index()][this->_index[l]->block()->index()])
+							(*i)->counter().incr(*j, k - src.begin());
 					}
 				}
-				for (size_t k = 0; k < this->_lts->states(); ++k)
-					this->_tmp[k] = this->_delta1[*j].contains(k);
+				std::fill(this->_tmp.begin(), this->_tmp.end(), false);
+				for (size_t k : src)
+					this->_tmp[k] = true;
 				for (std::vector<OLRTBlock*>::iterator k = this->_partition.begin(); k != this->_partition.end(); ++k) {
 					if (this->_relation.data()[(*i)->index()][(*k)->index()]) {
 						StateListElem* elem = (*k)->states();
 						do {
-							for (std::vector<size_t>::const_iterator l = this->_lts->dataPre()[*j][elem->state()].begin(); l != this->_lts->dataPre()[*j][elem->state()].end(); ++l)
-								this->_tmp[*l] = false;
+							for (size_t l : this->_lts->pre(elem->state(), *j))
+								this->_tmp[l] = false;
 							elem = elem->next();
 						} while (elem != (*k)->states());
 					}
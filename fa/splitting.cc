@@ -363,7 +363,6 @@ void Splitting::isolateAtLeaf(
 			ta2.addFinalState(state);
 			const Transition& t = ta2.addTransition(transBox.first->lhs(), transBox.first->label(), state)->first;
 			fae.setRoot(root, std::shared_ptr<TreeAut>(&ta2.uselessAndUnreachableFree(*fae.allocTA())));
-			fae.connectionGraph.invalidate(root);
 			std::set<const Box*> boxes;
 			splitting.isolateAtRoot(root, t, IsolateBoxF(transBox.second), boxes);
 			assert(boxes.count(transBox.second));
@@ -420,7 +419,6 @@ void Splitting::isolateAtLeaf(
 
 		// push 'ta2' into the FA and shake it all up
 		fae.appendRoot(&ta2.uselessAndUnreachableFree(*fae.allocTA()));
-		fae.connectionGraph.newRoot();
 		fae.makeDisjoint(fae.getRootCount() - 1);
 		fae.connectionGraph.invalidate(root);
 
@@ -527,8 +525,6 @@ void Splitting::isolateAtRoot(
 			tmp.unreachableFree(*tmp2);
 			fae_.appendRoot(tmp2);
 			fae_.makeDisjoint(fae_.getRootCount() - 1);
-			// update 'o'
-			fae_.connectionGraph.newRoot();
 		}
 
 		if (b->isType(box_type_e::bBox))
@@ -546,7 +542,6 @@ void Splitting::isolateAtRoot(
 
 	// exchange the original automaton with the new one
 	fae_.setRoot(root, std::shared_ptr<TreeAut>(tmp));
-	fae_.connectionGraph.invalidate(root);
 }
 
 
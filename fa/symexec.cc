@@ -36,22 +36,28 @@ void reportErrorNoLocation(const char* errMsg)
 
 
 // Standard library headers
+#include <cstdio>
+#include <fstream>
 #include <sstream>
 #include <vector>
 #include <list>
 #include <set>
 #include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
 
 // Code Listener headers
 #include <cl/cl_msg.hh>
 #include <cl/cldebug.hh>
 #include <cl/clutil.hh>
 #include <cl/code_listener.h>
+#include <cl/perfstats.hh>
 #include <cl/storage.hh>
 #include "../cl/ssd.h"
 
 // Forester headers
 #include "backward_run.hh"
+#include "call.hh"
 #include "executionmanager.hh"
 #include "fixpoint.hh"
 #include "fixpointinstruction.hh"
@@ -81,6 +87,103 @@ void dumpOperandTypes(std::ostream& os, const cl_operand* op) {
 // anonymous namespace
 namespace
 {
+/**
+ * @brief  Counts the executed states per exploration strategy
+ *
+ * @param[in]  strategy  The exploration strategy used
+ * @param[in]  states    The number of executed states
+ */
+void countStatesOf(explore_e strategy, size_t states)
+{
+	switch (strategy)
+	{
+		case explore_e::eDFS:
+			PERF_COUNT("fa.states_executed.dfs", states);
+			break;
+
+		case explore_e::eBFS:
+			PERF_COUNT("fa.states_executed.bfs", states);
+			break;
+
+		case explore_e::eFixpoint:
+			PERF_COUNT("fa.states_executed.fixpoint", states);
+			break;
+
+		case explore_e::eDelayFix:
+			PERF_COUNT("fa.states_executed.delay-fix", states);
+			break;
+	}
+}
+
+typedef std::unordered_map<const AbstractInstruction*,
+	std::vector<const AbstractInstruction*>> TReturnEdges;
+
+/**
+ * @brief  Maps each return from a function to the addresses it may return to
+ *
+ * The return addresses of a function are the ones loaded by its calls, see
+ * AbstractInstruction::returnAddresses().  The returns of a function are found
+ * by traversing its body from its entry, stepping over the nested calls.
+ *
+ * @param[in]   code   The microcode of the program
+ * @param[out]  edges  The return addresses of each reachable FI_ret
+ */
+void collectReturnEdges(
+	const Compiler::Assembly::CodeList&   code,
+	TReturnEdges&                         edges)
+{
+	// the return addresses of the calls of each function (given by its entry)
+	TReturnEdges addrsOf;
+	std::vector<const AbstractInstruction*> addrs;
+	std::vector<const AbstractInstruction*> succs;
+	for (const AbstractInstruction* instr : code)
+	{
+		addrs.clear();
+		instr->returnAddresses(addrs);
+		if (addrs.empty())
+			continue;
+
+		succs.clear();
+		instr->successors(succs);
+		for (const AbstractInstruction* entry : succs)
+		{
+			std::vector<const AbstractInstruction*>& dst = addrsOf[entry];
+			dst.insert(dst.end(), addrs.begin(), addrs.end());
+		}
+	}
+
+	for (const auto& fnc : addrsOf)
+	{
+		std::unordered_set<const AbstractInstruction*> body = { fnc.first };
+		std::vector<const AbstractInstruction*> todo = { fnc.first };
+
+		while (!todo.empty())
+		{
+			const AbstractInstruction* instr = todo.back();
+			todo.pop_back();
+
+			if (dynamic_cast<const FI_ret*>(instr))
+			{
+				std::vector<const AbstractInstruction*>& dst = edges[instr];
+				dst.insert(dst.end(), fnc.second.begin(), fnc.second.end());
+				continue;
+			}
+
+			// a nested call continues at its return address
+			succs.clear();
+			instr->returnAddresses(succs);
+			if (succs.empty())
+				instr->successors(succs);
+
+			for (const AbstractInstruction* succ : succs)
+			{
+				if (body.insert(succ).second)
+					todo.push_back(succ);
+			}
+		}
+	}
+}
+
 /**
  * @brief  Prints the trace to output stream
  *
@@ -201,6 +304,12 @@ private:  // data members
 
 	const ProgramConfig& conf_;
 
+	/// resume from the kept fixpoints in the next run of mainLoop()?
+	bool resume_;
+
+	/// the states scheduled again from the kept fixpoints (see resume_)
+	std::unordered_set<const SymState*> resumed_;
+
 	volatile bool dbgFlag_;
 	volatile bool userRequestFlag_;
 
@@ -249,6 +358,101 @@ protected:
 				static_cast<FixpointInstruction*>(instr)->clear();
 			}
 		}
+
+		resume_ = false;
+	}
+
+	/**
+	 * @brief  Clears the fixpoints that may depend on an abstraction
+	 *
+	 * The fixpoints reachable from @p absInstr are cleared, the other ones are
+	 * kept and the analysis is resumed from the states that extended them in the
+	 * next run of mainLoop().  A return from a function continues with the
+	 * return addresses of the calls of the function, see collectReturnEdges().
+	 *
+	 * @param[in]  absInstr  The abstraction that has been refined
+	 */
+	void clearFixpointsFrom(const AbstractInstruction* absInstr)
+	{
+		TReturnEdges retEdges;
+		collectReturnEdges(assembly_.code_, retEdges);
+
+		std::unordered_set<const AbstractInstruction*> reach = { absInstr };
+		std::vector<const AbstractInstruction*> todo = { absInstr };
+		std::vector<const AbstractInstruction*> succs;
+
+		while (!todo.empty())
+		{
+			const AbstractInstruction* instr = todo.back();
+			todo.pop_back();
+
+			succs.clear();
+			instr->successors(succs);
+			if (dynamic_cast<const FI_ret*>(instr))
+			{
+				const std::vector<const AbstractInstruction*>& addrs =
+					retEdges[instr];
+				succs.insert(succs.end(), addrs.begin(), addrs.end());
+			}
+
+			for (const AbstractInstruction* succ : succs)
+			{
+				if (reach.insert(succ).second)
+					todo.push_back(succ);
+			}
+		}
+
+		size_t cleared = 0;
+		for (auto instr : assembly_.code_)
+		{
+			if ((instr->getType() == fi_type_e::fiFix) && reach.count(instr))
+			{
+				static_cast<FixpointInstruction*>(instr)->clear();
+				++cleared;
+			}
+		}
+
+		FA_LOG("refinement cleared " << cleared << " fixpoint(s)");
+
+		resume_ = true;
+	}
+
+	/**
+	 * @brief  Schedules again the states that extended the kept fixpoints
+	 */
+	void resumeFixpoints()
+	{
+		std::vector<const SymState*> states;
+		for (auto instr : assembly_.code_)
+		{
+			if (instr->getType() == fi_type_e::fiFix)
+			{
+				static_cast<FixpointInstruction*>(instr)->resume(
+					execMan_, execMan_.root(), states);
+			}
+		}
+
+		resumed_.insert(states.begin(), states.end());
+		PERF_COUNT("fa.states_resumed", states.size());
+
+		FA_LOG("resuming the analysis from " << states.size() << " state(s)");
+	}
+
+	/**
+	 * @brief  Checks whether a trace starts with a resumed state
+	 *
+	 * Such a trace misses the part before the state, hence it cannot be used to
+	 * check whether a counterexample is spurious.
+	 */
+	bool isResumedTrace(const SymState::Trace& trace) const
+	{
+		for (const SymState* state : trace)
+		{
+			if (resumed_.count(state))
+				return true;
+		}
+
+		return false;
 	}
 
 
@@ -304,17 +508,24 @@ protected:
 
 		// schedule the initial state for processing
 		execMan_.init(
-			DataArray(assembly_.regFileSize_, Data::createUndef()),
+			RegisterFile(assembly_.regFileSize_, Data::createUndef()),
 			fae,
 			assembly_.code_.front()
 		);
 
+		resumed_.clear();
+		if (resume_)
+		{	// continue from the fixpoints kept after refinement
+			resume_ = false;
+			this->resumeFixpoints();
+		}
+
 		SymState* state = nullptr;
 
 		try
 		{	// expecting problems...
-			while (nullptr != (state = execMan_.dequeueDFS()))
-			{	// process all states in the DFS order
+			while (nullptr != (state = execMan_.dequeue()))
+			{	// process all states in the order given by the strategy
 				assert(nullptr != state);
 
 				const CodeStorage::Insn* insn = state->GetInstr()->insn();
@@ -345,6 +556,16 @@ protected:
 		{
 			assert(nullptr != e.state());
 
+			if (FA_USE_PREDICATE_ABSTRACTION
+				&& this->isResumedTrace(e.state()->getTrace()))
+			{	// the beginning of the trace is not known, start from scratch
+				FA_NOTE("Restarting the analysis to obtain the full trace...");
+
+				clearFixpoints();
+
+				return false;
+			}
+
 			const CodeStorage::Insn* insn = e.state()->GetInstr()->insn();
 			if (nullptr != insn)
 			{
@@ -394,6 +615,7 @@ protected:
 					assert(nullptr != failPoint->GetInstr());
 
 					FA_NOTE("The counterexample IS (PROBABLY) spurious");
+					PERF_COUNT("fa.refinements", 1);
 
 					FA_NOTE("Failing instuction: " << *failPoint->GetInstr());
 					FA_NOTE("Learnt predicate: " << *predicate);
@@ -410,7 +632,10 @@ protected:
 					// set the new predicate for abstraction
 					absInstr->addPredicate(predicate);
 
-					clearFixpoints();
+					if (FA_REFINE_FROM_FAILPOINT)
+						clearFixpointsFrom(absInstr);
+					else
+						clearFixpoints();
 
 					return false;
 				}
@@ -451,6 +676,8 @@ public:   // methods
 		assembly_{},
 		execMan_{},
 		conf_(conf),
+		resume_{false},
+		resumed_{},
 		dbgFlag_{false},
 		userRequestFlag_{false}
 	{ }
@@ -569,6 +796,17 @@ public:   // methods
 	void compile(const CodeStorage::Storage& stor, const CodeStorage::Fnc& entry)
 	{
 		compiler_.compile(assembly_, stor, entry);
+
+		if (conf_.printUcodeUnopt)
+		{
+			FA_LOG("Printing unoptimised microcode");
+			std::ostringstream os;
+			Compiler::Assembly::printUcode(os, assembly_.code_);
+			Streams::ucode(os.str().c_str());
+		}
+
+		if (conf_.optimizeUcode)
+			Compiler::optimize(assembly_);
 	}
 
 	const Compiler::Assembly& GetAssembly() const
@@ -576,16 +814,100 @@ public:   // methods
 		return assembly_;
 	}
 
+	/**
+	 * @brief  Imports the boxes learned by previous runs, if requested
+	 *
+	 * Starting with the boxes already learned saves the restarts of the
+	 * analysis that would be needed to learn them again.
+	 */
+	void importBoxes()
+	{
+		if (conf_.boxDb.empty())
+			return;
+
+		std::ifstream input(conf_.boxDb.c_str());
+		if (!input.good())
+		{	// nothing has been learned yet
+			FA_LOG("no box database found at \"" << conf_.boxDb << "\"");
+			return;
+		}
+
+		try
+		{
+			const size_t count = boxMan_.importBoxes(input, taBackend_);
+			FA_LOG("imported " << count << " box(es) from \"" << conf_.boxDb
+				<< "\"");
+			PERF_COUNT("fa.boxes_imported", count);
+		}
+		catch (const std::exception& e)
+		{	// a corrupt database may also yield huge counts or lengths
+			FA_WARN("ignoring the rest of the box database \"" << conf_.boxDb
+				<< "\": " << e.what());
+		}
+	}
+
+	/**
+	 * @brief  Exports the learned boxes for the next runs, if requested
+	 */
+	void exportBoxes() const
+	{
+		if (conf_.boxDb.empty())
+			return;
+
+		// write a temporary file first not to lose the database on a failure
+		const std::string tmpName = conf_.boxDb + ".tmp";
+		std::ofstream output(tmpName.c_str());
+		const size_t count = boxMan_.exportBoxes(output);
+		output.close();
+
+		if (!output.good() || std::rename(tmpName.c_str(), conf_.boxDb.c_str()))
+		{
+			FA_WARN("unable to write the box database \"" << conf_.boxDb << "\"");
+			std::remove(tmpName.c_str());
+			return;
+		}
+
+		FA_LOG("exported " << count << " box(es) to \"" << conf_.boxDb << "\"");
+	}
+
+	/**
+	 * @brief  Records the counters of the analysis into the performance stats
+	 */
+	void recordStats() const
+	{
+		PERF_COUNT("fa.states_executed", execMan_.statesEvaluated());
+		PERF_COUNT("fa.states_postponed", execMan_.statesPostponed());
+		countStatesOf(execMan_.strategy(), execMan_.statesEvaluated());
+		PERF_COUNT("fa.paths_evaluated", execMan_.pathsEvaluated());
+		PERF_COUNT("fa.boxes", boxMan_.boxDatabase().size());
+	}
+
 	void run()
 	{
 		// Assertions
 		assert(assembly_.code_.size());
 
+		PERF_TIMER("fa.symexec");
+
+		// record the counters however the analysis terminates
+		struct StatsGuard
+		{
+			const Engine& engine;
+			~StatsGuard() { engine.recordStats(); }
+		} statsGuard = { *this };
+
+		// set the strategy once for all runs of mainLoop(), the queue is not
+		// empty after a restart or a refinement
+		execMan_.setStrategy(conf_.explore, assembly_.code_);
+
+		this->importBoxes();
+
 		try
 		{	// expect problems...
 			while (!this->mainLoop())
 			{	// while the analysis hasn't terminated
 				FA_NOTE("Restarting the analysis...");
+				PERF_COUNT("fa.restarts", 1);
 			}
 
 			FA_NOTE("The program is SAFE.");
@@ -615,9 +937,13 @@ public:   // methods
 			FA_DEBUG_AT(1, "forester has generated " << execMan_.statesEvaluated()
 				<< " symbolic configuration(s) in " << execMan_.pathsEvaluated()
 				<< " path(s) using " << boxMan_.boxDatabase().size() << " box(es)");
+
+			this->exportBoxes();
 		}
 		catch (const ProgramError& e)
-		{ }
+		{
+			this->exportBoxes();
+		}
 		catch (std::exception& e)
 		{
 			FA_DEBUG(e.what());
@@ -32,7 +32,7 @@ void SymState::init(
 	SymState*                             parent,
 	AbstractInstruction*                  instr,
 	const std::shared_ptr<const FAE>&     fae,
-	const std::shared_ptr<DataArray>&     regs)
+	const std::shared_ptr<RegisterFile>&     regs)
 {
 	// Assertions
 	assert(Integrity(*fae).check());
@@ -58,7 +58,7 @@ void SymState::init(
 
 void SymState::init(
 	const SymState&                                oldState,
-	const std::shared_ptr<DataArray>               regs)
+	const std::shared_ptr<RegisterFile>               regs)
 {
 	instr_ = oldState.instr_;
 	fae_   = oldState.fae_;
@@ -70,7 +70,7 @@ void SymState::init(
 
 void SymState::init(
 	const SymState&                                oldState,
-	const std::shared_ptr<DataArray>               regs,
+	const std::shared_ptr<RegisterFile>               regs,
 	AbstractInstruction*                           insn)
 {
 	instr_ = insn;
@@ -100,7 +100,7 @@ void SymState::initChildFrom(
 void SymState::initChildFrom(
 	SymState*                                      parent,
 	AbstractInstruction*                           instr,
-	const std::shared_ptr<DataArray>               regs)
+	const std::shared_ptr<RegisterFile>               regs)
 {
 	// Assertions
 	assert(nullptr != parent);
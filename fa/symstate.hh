@@ -32,6 +32,7 @@
 #include "forestautext.hh"
 #include "link_tree.hh"
 #include "recycler.hh"
+#include "registerfile.hh"
 #include "types.hh"
 
 /**
@@ -65,7 +66,7 @@ private:  // data members
 	std::shared_ptr<const FAE> fae_;
 
 	/// the registers
-	std::shared_ptr<DataArray> regs_;
+	std::shared_ptr<RegisterFile> regs_;
 
 private:  // methods
 
@@ -101,7 +102,7 @@ public:   // methods
 		return fae_;
 	}
 
-	const DataArray& GetRegs() const
+	const RegisterFile& GetRegs() const
 	{
 		// Assertions
 		assert(nullptr != regs_);
@@ -128,10 +129,19 @@ public:   // methods
 		assert(nullptr != regs_);
 		assert(index < this->GetRegs().size());
 
-		(*regs_)[index] = data;
+		regs_->set(index, data);
 	}
 
-	const std::shared_ptr<DataArray>& GetRegsShPtr() const
+	void SetReg(size_t index, Data&& data)
+	{
+		// Assertions
+		assert(nullptr != regs_);
+		assert(index < this->GetRegs().size());
+
+		regs_->set(index, std::move(data));
+	}
+
+	const std::shared_ptr<RegisterFile>& GetRegsShPtr() const
 	{
 		return regs_;
 	}
@@ -166,7 +176,7 @@ public:   // methods
 		SymState*                                      parent,
 		AbstractInstruction*                           instr,
 		const std::shared_ptr<const FAE>&              fae,
-		const std::shared_ptr<DataArray>&              regs);
+		const std::shared_ptr<RegisterFile>&              regs);
 
 
 	/**
@@ -191,7 +201,7 @@ public:   // methods
 	 */
 	void init(
 		const SymState&                                oldState,
-		const std::shared_ptr<DataArray>               regs);
+		const std::shared_ptr<RegisterFile>               regs);
 
 
 	/**
@@ -205,7 +215,7 @@ public:   // methods
 	 */
 	void init(
 		const SymState&                                oldState,
-		const std::shared_ptr<DataArray>               regs,
+		const std::shared_ptr<RegisterFile>               regs,
 		AbstractInstruction*                           insn);
 
 
@@ -237,7 +247,7 @@ public:   // methods
 	void initChildFrom(
 		SymState*                                      parent,
 		AbstractInstruction*                           instr,
-		const std::shared_ptr<DataArray>               regs);
+		const std::shared_ptr<RegisterFile>               regs);
 
 	/**
 	 * @brief  Recycles the symbolic state for further use
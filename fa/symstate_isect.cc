@@ -239,7 +239,6 @@ public:   // methods
 
 			TreeAut* ta = fae_.allocTA();
 			fae_.appendRoot(ta);
-			fae_.connectionGraph.newRoot();
 		}
 
 		// the actual number of the root
@@ -389,8 +388,6 @@ void SymState::SubstituteRefs(
 		{
 			fae->appendRoot(nullptr);
 		}
-
-		fae->connectionGraph.newRoot();
 	}
 
 	assert(thisFAE->GetVarCount() == srcFAE->GetVarCount());
@@ -1001,6 +998,10 @@ void SymState::Intersect(
 	// update representation
 	fae->swapRoots(newRoots);
 
+	// the roots have been reordered (and relabelled below), so the info
+	// about all of them is stale
+	fae->connectionGraph.reset(fae->getRootCount());
+
 	FA_NOTE("Before relabelling: " << *fae);
 
 	for (size_t i = 0; i < index.size(); ++i)
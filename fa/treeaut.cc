@@ -227,6 +227,8 @@ void TA<T>::downwardTranslation(
 			labelIndex[ptrTransIDPair->first.label()],
 			stateIndex.size() + lhs[&(ptrTransIDPair->first.lhs())]);
 	}
+
+	lts.finalize();
 }
 
 
@@ -310,6 +312,8 @@ void TA<T>::upwardTranslation(
 		}
 	}
 
+	lts.finalize();
+
 	rel = std::vector<std::vector<bool>>(
 		part.size() + 2, std::vector<bool>(part.size() + 2, false));
 
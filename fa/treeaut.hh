@@ -21,6 +21,7 @@
 #define TREE_AUT_H
 
 // Standard library headers
+#include <memory>
 #include <vector>
 #include <set>
 #include <map>
@@ -269,7 +270,105 @@ public:   // data types
 		}
 	};
 
-	typedef std::set<TransIDPair*, CmpF> trans_set_type;
+	/**
+	 * @brief  Flat set of transitions
+	 *
+	 * The transitions are kept in a vector sorted by CmpF, so that traversals
+	 * run over contiguous memory.  Appending a transition greater than all the
+	 * others takes constant time, which is the common case when an automaton is
+	 * built from the transitions of another one.
+	 */
+	class TransSet
+	{
+	private:  // data members
+
+		std::vector<TransIDPair*> items_;
+
+	public:   // data types
+
+		typedef typename std::vector<TransIDPair*>::const_iterator const_iterator;
+		typedef const_iterator iterator;
+
+	public:   // methods
+
+		TransSet() :
+			items_{}
+		{ }
+
+		const_iterator begin() const { return items_.begin(); }
+
+		const_iterator end() const { return items_.end(); }
+
+		size_t size() const { return items_.size(); }
+
+		bool empty() const { return items_.empty(); }
+
+		void clear() { items_.clear(); }
+
+		/**
+		 * @brief  Inserts a transition
+		 *
+		 * @returns  The position of the transition and @p true if it was not
+		 *           present in the set yet
+		 */
+		std::pair<const_iterator, bool> insert(TransIDPair* x)
+		{
+			CmpF cmp;
+			if (items_.empty() || cmp(items_.back(), x))
+			{	// the fast path
+				items_.push_back(x);
+				return std::make_pair(items_.end() - 1, true);
+			}
+
+			typename std::vector<TransIDPair*>::iterator i =
+				std::lower_bound(items_.begin(), items_.end(), x, cmp);
+			if (!cmp(x, *i))
+				return std::make_pair(const_iterator(i), false);
+
+			return std::make_pair(const_iterator(items_.insert(i, x)), true);
+		}
+
+		/**
+		 * @brief  Inserts a sorted batch of transitions at once
+		 *
+		 * @param[in]   batch  Transitions sorted by CmpF, without duplicates
+		 * @param[out]  dups   Transitions of @p batch that were already present
+		 */
+		void merge(
+			const std::vector<TransIDPair*>&     batch,
+			std::vector<TransIDPair*>&           dups)
+		{
+			CmpF cmp;
+			const size_t mid = items_.size();
+			items_.insert(items_.end(), batch.begin(), batch.end());
+			if (!mid || (mid == items_.size()) || cmp(items_[mid - 1], items_[mid]))
+				return;
+
+			std::inplace_merge(items_.begin(), items_.begin() + mid, items_.end(), cmp);
+
+			size_t last = 0;
+			for (size_t i = 1; i < items_.size(); ++i)
+			{
+				if (cmp(items_[last], items_[i]))
+					items_[++last] = items_[i];
+				else
+					dups.push_back(items_[i]);
+			}
+
+			items_.resize(last + 1);
+		}
+
+		/**
+		 * @brief  Gets the first transition with the given parent state
+		 */
+		const_iterator lowerBound(size_t rhs) const
+		{
+			return std::lower_bound(items_.begin(), items_.end(), rhs,
+				[](const TransIDPair* t, size_t state) { return t->first.rhs() < state; });
+		}
+	};
+
+	typedef TransSet trans_set_type;
 
 	/**
 	 * @brief  Iterator over transitions
@@ -377,6 +476,12 @@ private:  // data members
 	size_t nextState_;
 	std::set<size_t> finalStates_;
 
+	/// The top-down index of transitions, shared by the copies of the TA
+	mutable std::shared_ptr<const td_cache_type> tdCache_;
+
+	/// The label index of transitions, shared by the copies of the TA
+	mutable std::shared_ptr<const lt_cache_type> ltCache_;
+
 public:   // data members
 
 	Backend* backend;
@@ -391,6 +496,8 @@ public:
 		Backend&             backend) :
 		nextState_(0),
 		finalStates_{},
+		tdCache_{},
+		ltCache_{},
 		backend(&backend),
 		maxRank(0),
 		transitions{}
@@ -401,6 +508,8 @@ public:
 		bool                 copyFinalStates = true) :
 		nextState_(ta.nextState_),
 		finalStates_{},
+		tdCache_(ta.tdCache_),
+		ltCache_(ta.ltCache_),
 		backend(ta.backend),
 		maxRank(ta.maxRank),
 		transitions(ta.transitions)
@@ -423,6 +532,8 @@ public:
 		bool                 copyFinalStates = true) :
 		nextState_(ta.nextState_),
 		finalStates_(),
+		tdCache_{},
+		ltCache_{},
 		backend(ta.backend),
 		maxRank(ta.maxRank),
 		transitions()
@@ -432,13 +543,16 @@ public:
 			finalStates_ = ta.finalStates_;
 		}
 
+		std::vector<TransIDPair*> batch;
 		for (TransIDPair* trans : ta.transitions)
 		{	// copy transitions (only those requested)
 			if (f(&trans->first))
 			{
-				this->addTransition(trans);
+				batch.push_back(this->transCache().addRef(trans));
 			}
 		}
+
+		this->internalAddBatch(batch);
 	}
 
 	typename Transition::lhs_cache_type& lhsCache() const
@@ -458,6 +572,8 @@ public:
 		{
 			if (t.lhs().size() > this->maxRank)
 				this->maxRank = t.lhs().size();
+
+			this->invalidateIndices();
 		} else
 		{
 			this->transCache().release(x);
@@ -465,6 +581,67 @@ public:
 		return x;
 	}
 
+	/**
+	 * @brief  Inserts a batch of transitions of the backend of the TA
+	 *
+	 * @param[in]  batch  Transitions sorted by CmpF, without duplicates, each of
+	 *                    them with a reference already taken for the TA
+	 */
+	void internalAddBatch(const std::vector<TransIDPair*>& batch)
+	{
+		if (batch.empty())
+			return;
+
+		std::vector<TransIDPair*> dups;
+		this->transitions.merge(batch, dups);
+		for (TransIDPair* trans : dups)
+			this->transCache().release(trans);
+
+		for (const TransIDPair* trans : batch)
+		{
+			if (trans->first.lhs().size() > this->maxRank)
+				this->maxRank = trans->first.lhs().size();
+		}
+
+		this->invalidateIndices();
+	}
+
+	/**
+	 * @brief  Copies transitions of another TA into this TA in a batch
+	 *
+	 * @param[in]  src  The TA whose transitions are to be copied
+	 * @param[in]  f    Predicate over transitions to be copied
+	 */
+	template <class F>
+	void addTransitionsOf(const TA<T>& src, F f)
+	{
+		if (src.backend != this->backend)
+		{	// transitions need to be created in our backend
+			for (const TransIDPair* trans : src.transitions)
+			{
+				if (f(&trans->first))
+					this->addTransition(trans);
+			}
+
+			return;
+		}
+
+		std::vector<TransIDPair*> batch;
+		for (TransIDPair* trans : src.transitions)
+		{
+			if (f(&trans->first))
+				batch.push_back(this->transCache().addRef(trans));
+		}
+
+		this->internalAddBatch(batch);
+	}
+
+	void invalidateIndices()
+	{
+		tdCache_.reset();
+		ltCache_.reset();
+	}
+
 	~TA()
 	{
 		this->clear();
@@ -482,12 +659,7 @@ public:
 
 	typename trans_set_type::const_iterator _lookup(size_t rhs) const
 	{
-		char buffer[sizeof(std::pair<const Transition, size_t>)];
-		std::pair<const Transition, size_t>* tPtr = reinterpret_cast<std::pair<const Transition, size_t>*>(buffer);
-		new (reinterpret_cast<TTBase<T>*>(const_cast<Transition*>(&tPtr->first))) TTBase<T>(nullptr, T(), rhs);
-		typename trans_set_type::const_iterator i = this->transitions.lower_bound(tPtr);
-		(reinterpret_cast<TTBase<T>*>(const_cast<Transition*>(&tPtr->first)))->~TTBase();
-		return i;
+		return this->transitions.lowerBound(rhs);
 	}
 
 	typename TA<T>::Iterator begin(size_t rhs) const
@@ -547,6 +719,8 @@ public:
 		this->backend = rhs.backend;
 		this->transitions = rhs.transitions;
 		finalStates_ = rhs.finalStates_;
+		tdCache_ = rhs.tdCache_;
+		ltCache_ = rhs.ltCache_;
 
 		for (TransIDPair* trans : this->transitions)
 		{	// copy transitions
@@ -565,6 +739,7 @@ public:
 			this->transCache().release(trans);
 		}
 		this->transitions.clear();
+		this->invalidateIndices();
 		finalStates_.clear();
 	}
 
@@ -668,6 +843,36 @@ public:
 		return cache;
 	}
 
+	/**
+	 * @brief  Gets the top-down cache for transitions of the TA
+	 *
+	 * The same as buildTDCache() but the cache is built only once and kept
+	 * until the transitions of the TA change.
+	 */
+	const td_cache_type& getTDCache() const
+	{
+		if (!tdCache_)
+			tdCache_ = std::make_shared<const td_cache_type>(this->buildTDCache());
+
+		return *tdCache_;
+	}
+
+	/**
+	 * @brief  Gets transitions of the top-down cache with the given parent
+	 *
+	 * @returns  The transitions with @p state as the parent state (possibly
+	 *           none)
+	 */
+	static const std::vector<const Transition*>& tdLookup(
+		const td_cache_type&                 cache,
+		size_t                               state)
+	{
+		static const std::vector<const Transition*> none;
+
+		typename td_cache_type::const_iterator i = cache.find(state);
+		return (cache.end() == i)? none : i->second;
+	}
+
 	void buildBUCache(bu_cache_type& cache) const
 	{
 		std::unordered_set<size_t> s;
@@ -692,6 +897,24 @@ public:
 		}
 	}
 
+	/**
+	 * @brief  Gets the label cache for transitions of the TA
+	 *
+	 * The cache is built only once and kept until the transitions of the TA
+	 * change.
+	 */
+	const lt_cache_type& getLTCache() const
+	{
+		if (!ltCache_)
+		{
+			std::shared_ptr<lt_cache_type> cache = std::make_shared<lt_cache_type>();
+			this->buildLTCache(*cache);
+			ltCache_ = cache;
+		}
+
+		return *ltCache_;
+	}
+
 	const TransIDPair* addTransition(
 		const std::vector<size_t>&          lhs,
 		const T&                            label,
@@ -936,10 +1159,8 @@ public:
 		const TA<T>&                     src2,
 		size_t                           stateOffset = 0)
 	{
-		lt_cache_type cache1, cache2;
-		src1.buildLTCache(cache1);
-		src2.buildLTCache(cache2);
-		return TA<T>::buProduct(cache1, cache2, TA<T>::IntersectF(dst, src1, src2), stateOffset);
+		return TA<T>::buProduct(src1.getLTCache(), src2.getLTCache(),
+			TA<T>::IntersectF(dst, src1, src2), stateOffset);
 	}
 
 	struct PredicateF
@@ -969,10 +1190,8 @@ public:
 		std::vector<size_t>&                 dst,
 		const TA<T>&                         predicate) const
 	{
-		lt_cache_type cache1, cache2;
-		this->buildLTCache(cache1);
-		predicate.buildLTCache(cache2);
-		TA<T>::buProduct(cache1, cache2, TA<T>::PredicateF(dst, predicate));
+		TA<T>::buProduct(this->getLTCache(), predicate.getLTCache(),
+			TA<T>::PredicateF(dst, predicate));
 	}
 
 
@@ -1020,7 +1239,7 @@ public:
 		F                                          f,
 		const Index<size_t>&                       stateIndex) const
 	{
-		td_cache_type cache = this->buildTDCache();
+		const td_cache_type& cache = this->getTDCache();
 
 		std::vector<std::vector<bool>> tmp;
 
@@ -1031,21 +1250,19 @@ public:
 			for (Index<size_t>::iterator i = stateIndex.begin(); i != stateIndex.end(); ++i)
 			{
 				const size_t& state1 = i->second;
-				typename td_cache_type::iterator j = cache.insert(
-					std::make_pair(i->first, std::vector<const Transition*>())
-				).first;
+				const std::vector<const Transition*>& trans1s =
+					TA<T>::tdLookup(cache, i->first);
 				for (Index<size_t>::iterator k = stateIndex.begin(); k != stateIndex.end(); ++k)
 				{
 					const size_t& state2 = k->second;
 					if ((state1 == state2) || !tmp[state1][state2])
 						continue;
-					typename td_cache_type::iterator l = cache.insert(
-						std::make_pair(k->first, std::vector<const Transition*>())
-					).first;
+					const std::vector<const Transition*>& trans2s =
+						TA<T>::tdLookup(cache, k->first);
 					bool match = true;
-					for (const Transition* trans1 : j->second)
+					for (const Transition* trans1 : trans1s)
 					{
-						for (const Transition* trans2 : l->second)
+						for (const Transition* trans2 : trans2s)
 						{
 							if (!TA<T>::transMatch(trans1, trans2, f, tmp, stateIndex))
 							{
@@ -1291,15 +1508,15 @@ public:
 		const std::vector<std::vector<bool>>&     cons,
 		const Index<size_t>&                      stateIndex) const
 	{
-		td_cache_type cache = this->buildTDCache();
+		const td_cache_type& cache = this->getTDCache();
 
 		for (size_t state : finalStates_)
 			dst.addFinalState(state);
 
-		for (typename td_cache_type::iterator i = cache.begin(); i != cache.end(); ++i)
+		for (typename td_cache_type::const_iterator i = cache.begin(); i != cache.end(); ++i)
 		{
 			std::list<const Transition*> tmp;
-			for (typename std::vector<const Transition*>::iterator j = i->second.begin(); j != i->second.end(); ++j)
+			for (typename std::vector<const Transition*>::const_iterator j = i->second.begin(); j != i->second.end(); ++j)
 			{
 				bool noskip = true;
 				for (typename std::list<const Transition*>::iterator k = tmp.begin(); k != tmp.end(); )
@@ -1507,19 +1724,14 @@ public:
 	 */
 	TA& copyTransitions(TA<T>& dst) const
 	{
-		for (const TransIDPair* trans : this->transitions)
-			dst.addTransition(trans);
+		dst.addTransitionsOf(*this, [](const Transition*){ return true; });
 		return dst;
 	}
 
 	template <class F>
 	TA& copyTransitions(TA<T>& dst, F f) const
 	{
-		for (const TransIDPair* trans : this->transitions)
-		{
-			if (f(&trans->first))
-				dst.addTransition(trans);
-		}
+		dst.addTransitionsOf(*this, f);
 		return dst;
 	}
 
@@ -1542,11 +1754,8 @@ public:
 		for (size_t state : b.finalStates_)
 			dst.addFinalState(state);
 
-		for (const TransIDPair* trans : a.transitions)
-			dst.addTransition(trans);
-
-		for (const TransIDPair* trans : b.transitions)
-			dst.addTransition(trans);
+		a.copyTransitions(dst);
+		b.copyTransitions(dst);
 
 		return dst;
 	}
@@ -1562,8 +1771,7 @@ public:
 				dst.addFinalState(state);
 		}
 
-		for (const TransIDPair* trans : src.transitions)
-			dst.addTransition(trans);
+		src.copyTransitions(dst);
 
 		return dst;
 	}
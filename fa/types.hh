@@ -264,6 +264,21 @@ struct Data
 		}
 	}
 
+	/**
+	 * @brief  Move constructor
+	 *
+	 * Steals the nested data of a structure instead of copying them.
+	 *
+	 * @param[in,out]  data  The object to be moved, left undefined
+	 */
+	Data(
+		Data&&               data) :
+		type(data.type),
+		size(data.size)
+	{
+		this->stealValue(data);
+	}
+
 	/**
 	 * @brief  Destructor
 	 *
@@ -311,6 +326,27 @@ struct Data
 		return *this;
 	}
 
+	/**
+	 * @brief  The move assignment operator
+	 *
+	 * Steals the nested data of a structure instead of copying them.
+	 *
+	 * @param[in,out]  rhs  The object to be moved, left undefined
+	 *
+	 * @returns  The object
+	 */
+	Data& operator=(Data&& rhs)
+	{
+		if (this == &rhs) { return *this; }
+
+		this->clear();
+		this->type = rhs.type;
+		this->size = rhs.size;
+		this->stealValue(rhs);
+
+		return *this;
+	}
+
 	/**
 	 * @brief  Creates an undefined value
 	 *
@@ -494,6 +530,42 @@ struct Data
 		this->type = data_type_e::t_undef;
 	}
 
+private:  // methods
+
+	/**
+	 * @brief  Takes over the value of another object
+	 *
+	 * Takes over the additional type information of @p data, which is left
+	 * undefined afterwards. The type of @p this needs to be already set.
+	 *
+	 * @param[in,out]  data  The object whose value is taken
+	 */
+	void stealValue(Data& data)
+	{
+		switch (data.type)
+		{
+			case data_type_e::t_native_ptr:
+				this->d_native_ptr = data.d_native_ptr; break;
+			case data_type_e::t_void_ptr:
+				this->d_void_ptr_size = data.d_void_ptr_size; break;
+			case data_type_e::t_ref:
+				this->d_ref.root = data.d_ref.root;
+				this->d_ref.displ = data.d_ref.displ; break;
+			case data_type_e::t_int:
+				this->d_int = data.d_int; break;
+			case data_type_e::t_bool:
+				this->d_bool = data.d_bool; break;
+			case data_type_e::t_struct:
+				this->d_struct = data.d_struct;
+				data.d_struct = nullptr;
+				data.type = data_type_e::t_undef;
+				break;
+			default: break;
+		}
+	}
+
+public:   // methods
+
 	/**
 	 * @brief  Are the type and value defined?
 	 *
@@ -141,7 +141,6 @@ public:
 		this->boxMerge(*ta, *this->fae.getRoot(root), *box->getOutput(), box, index);
 
 		this->fae.setRoot(root, ta);
-		this->fae.connectionGraph.invalidate(root);
 
 		if (!box->getInput())
 			return;
@@ -160,8 +159,6 @@ public:
 
 		this->boxMerge(*this->fae.getRoot(aux), tmp, *box->getInput(), nullptr, index);
 
-		this->fae.connectionGraph.invalidate(aux);
-
 //		this->fae.updateConnectionGraph();
 	}
 
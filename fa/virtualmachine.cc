@@ -191,7 +191,6 @@ size_t VirtualMachine::nodeCreate(
 
 	// add the tree automaton into the forest automaton
 	fae_.appendRoot(ta);
-	fae_.connectionGraph.newRoot();
 	return root;
 }
 
@@ -211,17 +210,21 @@ void VirtualMachine::nodeDelete(size_t root)
 	// make all references to this rootpoint dangling
 	for (size_t i = 0; i < fae_.getRootCount(); ++i)
 	{
-		if (root == i)
-		{	// for the 'root'
-			fae_.connectionGraph.invalidate(i);
-		}
-
 		if (!fae_.getRoot((i)))
 			continue;
 
+		// a valid signature must not be stale, see the invalidation of roots
+		// being replaced by setRoot()
+		assert(fae_.connectionGraph.checkRoot(i, *fae_.getRoot(i)));
+
+		if (fae_.connectionGraph.data[i].valid
+			&& !fae_.connectionGraph.hasReference(i, root))
+		{	// the valid signature says that there is no reference to 'root'
+			continue;
+		}
+
 		fae_.setRoot(i, std::shared_ptr<TreeAut>(
 			fae_.invalidateReference(fae_.getRoot(i).get(), root)));
-		fae_.connectionGraph.invalidate(i);
 	}
 }
 
@@ -248,7 +251,6 @@ void VirtualMachine::nodeModify(
 	TreeAut* tmp = fae_.allocTA();
 	ta.unreachableFree(*tmp);
 	fae_.setRoot(root, std::shared_ptr<TreeAut>(tmp));
-	fae_.connectionGraph.invalidate(root);
 }
 
 
@@ -270,7 +272,6 @@ void VirtualMachine::nodeModifyMultiple(
 	TreeAut* tmp = fae_.allocTA();
 	ta.unreachableFree(*tmp);
 	fae_.setRoot(root, std::shared_ptr<TreeAut>(tmp));
-	fae_.connectionGraph.invalidate(root);
 }
 
 
@@ -968,6 +968,26 @@ void cl_chain_append(
         struct cl_code_listener         *chain,
         struct cl_code_listener         *listener);
 
+/**
+ * append cl_code_listener object to chain, the object is notified in a separate
+ * thread through a bounded queue so that it does not slow down the others
+ * @param chain Object returned by cl_chain_create() function.
+ * @param listener Object ought to be added to the chain.
+ * @note Operands and strings are copied for the listener, whereas types,
+ * variables and locations need to stay valid until the chain is destroyed.
+ */
+void cl_chain_append_async(
+        struct cl_code_listener         *chain,
+        struct cl_code_listener         *listener);
+
+/**
+ * write the performance counters, timers and histograms collected so far
+ * @param file_name name of the output file, CSV is written if the name ends
+ * with ".csv", JSON otherwise
+ * @return true on success, false if the file could not be written
+ */
+bool cl_perf_stats_export(const char *file_name);
+
 #ifdef __cplusplus
 }
 #endif
@@ -43,4 +43,7 @@ bool printMemUsage(const char *justCompletedFncName);
 /// print the peak over all calls of rawMemUsage(), but relative to the drift
 bool printPeakMemUsage();
 
+/// provide the peak over all calls of rawMemUsage(), but relative to the drift
+bool peakMemUsage(ssize_t *pDst);
+
 #endif /* H_GUARD_MEM_DEBUG_H */
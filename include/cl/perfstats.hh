@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of predator.
+ *
+ * predator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * predator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with predator.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef H_GUARD_PERF_STATS_H
+#define H_GUARD_PERF_STATS_H
+
+/**
+ * @file perfstats.hh
+ * process-wide registry of performance counters, timers and histograms, which
+ * can be exported in a machine-readable form by cl_perf_stats_export()
+ */
+
+#include <chrono>
+#include <string>
+
+namespace PerfStats {
+
+/// monotonically growing counter, e.g. count of executed states
+struct Counter {
+    long long                   value;
+
+    Counter(): value(0) { }
+
+    void add(long long amount = 1) {
+        value += amount;
+    }
+};
+
+/// accumulated (wall) time of a repeatedly executed phase
+struct Timer {
+    unsigned long               calls;
+    double                      total;      ///< in seconds
+    double                      max;        ///< the longest call, in seconds
+
+    Timer(): calls(0), total(0.0), max(0.0) { }
+
+    void add(double sec);
+};
+
+/// distribution of sampled values, bucketed by powers of two
+struct Histogram {
+    /// [0] counts values < 1, [i] counts values in [2^(i-1), 2^i)
+    static const int            BUCKETS = 64;
+
+    unsigned long               count;
+    long long                   sum;
+    long long                   min;
+    long long                   max;
+    unsigned long               buckets[BUCKETS];
+
+    Histogram();
+
+    void add(long long value);
+};
+
+/// look up a counter by name, created on the first use, never invalidated
+Counter& counter(const std::string &name);
+
+/// look up a timer by name, created on the first use, never invalidated
+Timer& timer(const std::string &name);
+
+/// look up a histogram by name, created on the first use, never invalidated
+Histogram& histogram(const std::string &name);
+
+/// write all the data collected so far, CSV for *.csv, JSON otherwise
+bool exportToFile(const std::string &fileName);
+
+/// accumulate the time spent in the enclosing scope into the given timer
+class ScopedTimer {
+    public:
+        typedef std::chrono::steady_clock TClock;
+
+        ScopedTimer(Timer &timer):
+            timer_(timer),
+            start_(TClock::now())
+        {
+        }
+
+        ~ScopedTimer() {
+            const std::chrono::duration<double> diff = TClock::now() - start_;
+            timer_.add(diff.count());
+        }
+
+    private:
+        // not implemented
+        ScopedTimer(const ScopedTimer &);
+        ScopedTimer& operator=(const ScopedTimer &);
+
+        Timer                       &timer_;
+        const TClock::time_point    start_;
+};
+
+} // namespace PerfStats
+
+/**
+ * measure the time spent in the enclosing scope, at most one per scope
+ * @note the registry is looked up only once per call site
+ */
+#define PERF_TIMER(name)                                                    \
+    static PerfStats::Timer &perfTimer_ = PerfStats::timer(name);           \
+    const PerfStats::ScopedTimer perfScope_(perfTimer_)
+
+/// add the given amount to the named counter
+#define PERF_COUNT(name, amount) do {                                       \
+    static PerfStats::Counter &perfCounter_ = PerfStats::counter(name);     \
+    perfCounter_.add(amount);                                               \
+} while (0)
+
+/// record the given value into the named histogram
+#define PERF_SAMPLE(name, value) do {                                       \
+    static PerfStats::Histogram &perfHisto_ = PerfStats::histogram(name);   \
+    perfHisto_.add(value);                                                  \
+} while (0)
+
+#endif /* H_GUARD_PERF_STATS_H */
@@ -28,6 +28,8 @@
 #include <cl/storage.hh>            // for CodeStorage::TypeDb::dataPtrSizeof()
 
 #include <algorithm>                // for std::reverse
+#include <map>
+#include <set>
 
 #include <boost/foreach.hpp>
 
@@ -47,24 +49,124 @@ typedef FixedPoint::THeapIdx                        THeapIdx;
 typedef FixedPoint::THeapIdent                      THeapIdent;
 typedef FixedPoint::TShapeIdent                     TShapeIdent;
 
+/// result of diffHeaps() for a pair of heaps
+struct HeapDiff {
+    bool                            ok;
+    TMetaOpSet                      metaOps;
+
+    HeapDiff(): ok(false) { }
+};
+
+typedef std::pair<THeapIdent, THeapIdent>           THeapIdentPair;
+typedef std::map<THeapIdentPair, HeapDiff>          THeapDiffMap;
+typedef std::set<THeapIdent>                        THeapSet;
+
+/// bit mask of EMetaOperation values
+typedef unsigned                                    TMetaOpKinds;
+
 struct MatchCtx {
     TMatchList                     &matchList;
     const OpCollection             &opCollection;
     const TProgState               &progState;
     FixedPoint::TShapeSeqList       shapeSeqs;
 
+    /// diffHeaps() is computed at most once per each trace edge
+    THeapDiffMap                    diffs;
+
+    /// kinds of meta-operations that appear on trace edges of the program
+    TMetaOpKinds                    progKinds;
+
     MatchCtx(
             TMatchList             &matchList_,
             const OpCollection     &opCollection_,
             const TProgState       &progState_):
         matchList(matchList_),
         opCollection(opCollection_),
-        progState(progState_)
+        progState(progState_),
+        progKinds(0U)
     {
         FixedPoint::collectShapeSequences(&shapeSeqs, progState);
     }
 };
 
+TMetaOpKinds kindsOf(const TMetaOpSet &metaOps)
+{
+    TMetaOpKinds kinds = 0U;
+    BOOST_FOREACH(const MetaOperation &mo, metaOps)
+        kinds |= (1U << mo.code);
+
+    return kinds;
+}
+
+/// return the memoised difference of the given pair of heaps, 0 on failure
+const TMetaOpSet* diffOf(
+        MatchCtx                   &ctx,
+        const THeapIdent            heap0,
+        const THeapIdent            heap1)
+{
+    const THeapIdentPair key(heap0, heap1);
+    THeapDiffMap::iterator it = ctx.diffs.find(key);
+    if (ctx.diffs.end() == it) {
+        // compute the difference of the pair of heaps
+        it = ctx.diffs.insert(std::make_pair(key, HeapDiff())).first;
+        HeapDiff &diff = it->second;
+
+        const SymHeap &sh0 = *heapByIdent(ctx.progState, heap0);
+        const SymHeap &sh1 = *heapByIdent(ctx.progState, heap1);
+        diff.ok = diffHeaps(&diff.metaOps, sh0, sh1);
+    }
+
+    const HeapDiff &diff = it->second;
+    if (!diff.ok)
+        return 0;
+
+    return &diff.metaOps;
+}
+
+/// diff trace edges reachable from the given heaps in the given direction
+void collectProgKindsFrom(
+        MatchCtx                   &ctx,
+        const THeapSet             &heaps,
+        const bool                  reverse)
+{
+    using namespace FixedPoint;
+    THeapSet seen = heaps;
+    std::vector<THeapIdent> todo(heaps.begin(), heaps.end());
+    while (!todo.empty()) {
+        const THeapIdent heap = todo.back();
+        todo.pop_back();
+
+        const LocalState &locState = ctx.progState[heap./* loc */first];
+        const TEdgeListByHeapIdx &eListByHeapIdx = (reverse)
+            ? locState.traceInEdges
+            : locState.traceOutEdges;
+
+        BOOST_FOREACH(const TraceEdge *te, eListByHeapIdx[heap./* sh */second]) {
+            const TMetaOpSet *pMetaOps = diffOf(ctx, te->src, te->dst);
+            if (pMetaOps)
+                ctx.progKinds |= kindsOf(*pMetaOps);
+
+            const THeapIdent next = (reverse) ? te->src : te->dst;
+            if (insertOnce(seen, next))
+                todo.push_back(next);
+        }
+    }
+}
+
+/// diff the trace edges the matching can crawl and collect their kinds
+void collectProgKinds(MatchCtx &ctx)
+{
+    // anchor heaps are always taken from the container shape sequences
+    THeapSet heaps;
+    BOOST_FOREACH(const FixedPoint::TShapeSeq &seq, ctx.shapeSeqs)
+        BOOST_FOREACH(const TShapeIdent &shIdent, seq)
+            heaps.insert(shIdent.first);
+
+    // templates are searched either forward or backward from the anchor heap
+    collectProgKindsFrom(ctx, heaps, /* reverse */ false);
+    collectProgKindsFrom(ctx, heaps, /* reverse */ true);
+}
+
 unsigned countObjects(const SymHeap &sh)
 {
     TObjList objs;
@@ -499,21 +601,23 @@ bool isIndependentOp(
 bool processDiffOf(
         FootprintMatch             *pMatch,
         TMetaOpSet                 *pLookup,
-        const TProgState           &progState,
+        MatchCtx                   &ctx,
         const THeapIdent            heap0,
         const THeapIdent            heap1,
         const ESearchDirection      sd)
 {
-    const SymHeap &sh0 = *heapByIdent(progState, heap0);
-    const SymHeap &sh1 = *heapByIdent(progState, heap1);
+    const SymHeap &sh0 = *heapByIdent(ctx.progState, heap0);
+    const SymHeap &sh1 = *heapByIdent(ctx.progState, heap1);
 
-    // compute the difference of the pair of heaps
-    TMetaOpSet metaOpsNow;
-    if (!diffHeaps(&metaOpsNow, sh0, sh1)) {
+    // take the difference of the pair of heaps
+    const TMetaOpSet *pMetaOpsNow = diffOf(ctx, heap0, heap1);
+    if (!pMetaOpsNow) {
         TM_DEBUG("diffHeaps() has failed");
         return false;
     }
 
+    const TMetaOpSet &metaOpsNow = *pMetaOpsNow;
+
     TObjSet freshObjs;
     BOOST_FOREACH(const MetaOperation &mo, metaOpsNow)
         if (MO_ALLOC == mo.code)
@@ -669,7 +773,7 @@ void seekTemplateMatchInstances(
                         objMap, fmInit.props, sh))
                 continue;
 
-            if (!processDiffOf(&fm, &metaOpsToLookFor, ctx.progState,
+            if (!processDiffOf(&fm, &metaOpsToLookFor, ctx,
                         heap0, heap1, sd))
                 // failed to process the difference of the neighbouring heaps
                 continue;
@@ -714,19 +818,15 @@ void seekTemplateMatchInstances(
 
 bool diffHeapsIfNeeded(
         TMetaOpSet                 *pMetaOps,
-        const OpFootprint          &fp,
+        const TMetaOpSet           &tplMetaOps,
         const FootprintMatch       &fm)
 {
     if (!pMetaOps->empty())
         // diff already computed
         return true;
 
-    // time to diff the template
-    if (!diffHeaps(pMetaOps, fp.input, fp.output)) {
-        CL_BREAK_IF("AdtOp::diffHeaps() has failed");
-        return false;
-    }
-
+    // time to relocate the diff of the template
+    *pMetaOps = tplMetaOps;
     relocOffsetsInMetaOps(pMetaOps, fm);
     if (pMetaOps->empty()) {
         CL_BREAK_IF("AdtOp::diffHeaps() returned an empty set");
@@ -746,6 +846,20 @@ void matchSingleFootprint(
     TMetaOpSet metaOps;
     TShapeIdentSet checkedShapes;
 
+    // diff the template
+    TMetaOpSet tplMetaOps;
+    if (!diffHeaps(&tplMetaOps, fp.input, fp.output)) {
+        CL_BREAK_IF("AdtOp::diffHeaps() has failed");
+        return;
+    }
+
+    // each meta-operation of the footprint has to be found on a trace edge
+    if (kindsOf(tplMetaOps) & ~ctx.progKinds) {
+        TM_DEBUG("tpl = " << tpl.name() << "[" << fpIdent.second << "]"
+                ", skipped as some of its meta-operations never occur");
+        return;
+    }
+
     BOOST_FOREACH(FixedPoint::TShapeSeq seq, ctx.shapeSeqs) {
         // resolve shape sequence to search through
         const ESearchDirection sd = tpl.searchDirection();
@@ -766,7 +880,7 @@ void matchSingleFootprint(
                 // already checked as part of different shape sequence
                 break;
 
-            if (!diffHeapsIfNeeded(&metaOps, fp, fm))
+            if (!diffHeapsIfNeeded(&metaOps, tplMetaOps, fm))
                 // non-recoverable error while computing diff of the footprint
                 return;
 
@@ -796,6 +910,12 @@ void matchTemplates(
     CL_DEBUG("[ADT] found " << ctx.shapeSeqs.size()
             << " container shape sequences");
 
+    if (ctx.shapeSeqs.empty())
+        // no anchor heaps to match any template with
+        return;
+
+    collectProgKinds(ctx);
+
     const TTemplateIdx tplCnt = opCollection.size();
     for (TTemplateIdx tplIdx = 0; tplIdx < tplCnt; ++tplIdx) {
         const OpTemplate &tpl = ctx.opCollection[tplIdx];
@@ -821,8 +941,6 @@ void pushBackIfLast(
         pDst->push_back(lastLoc);
 }
 
-typedef std::set<THeapIdent>                        THeapSet;
-
 /// this assumes heapSet to be sorted by location idx, then by heap idx
 void collectReplacedInsnsCore(
         TInsnList                  *pDst,
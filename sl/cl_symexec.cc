@@ -23,10 +23,13 @@
 #include <cl/cl_msg.hh>
 #include <cl/clutil.hh>
 #include <cl/memdebug.hh>
+#include <cl/perfstats.hh>
 #include <cl/storage.hh>
 
 #include "fixed_point_proxy.hh"
 #include "glconf.hh"
+#include "membudget.hh"
+#include "symbin.hh"
 #include "symbt.hh"
 #include "symdump.hh"
 #include "symexec.hh"
@@ -147,6 +150,7 @@ void execVirtualRoots(const CodeStorage::Storage &stor)
 void launchSymExec(const CodeStorage::Storage &stor)
 {
     using namespace CodeStorage;
+    PERF_TIMER("sl.symexec");
 
     // look for main() by name
     CL_DEBUG("looking for 'main()' at gl scope...");
@@ -178,9 +182,15 @@ void clEasyRun(const CodeStorage::Storage &stor, const char *configString)
 {
     initSymDump();
 
+    // a batch run analyzes several modules in one process, start from scratch
+    MemBudget::reset();
+
     // read parameters of symbolic execution
     GlConf::loadConfigString(configString);
 
+    // match the called functions against built-ins once for all calls
+    resolveBuiltIns(stor);
+
     // run symbolic execution
     try {
         launchSymExec(stor);
@@ -225,6 +225,16 @@
  */
 #define SE_INT_ARITHMETIC_LIMIT             10
 
+/**
+ * if 1, a pair of distinct integral constants being joined (typically a loop
+ * counter at the loop head) is widened at once in the direction the value has
+ * evolved, instead of enumerating the values up to SE_INT_ARITHMETIC_LIMIT and
+ * then waiting for another iteration to widen the resulting range.  The range
+ * is created even if (SE_ALLOW_INT_RANGES & 0x1) is zero, which would abstract
+ * the pair of constants by an unknown value otherwise.
+ */
+#define SE_ACCELERATE_INT_LOOPS             0
+
 /**
  * - 0 ... join states on each basic block entry
  * - 1 ... join only when traversing a loop-closing edge, entailment otherwise
@@ -233,11 +243,24 @@
  */
 #define SE_JOIN_ON_LOOP_EDGES_ONLY          3
 
+/**
+ * once a basic block holds at least this count of heaps, join on each entry of
+ * the block (also by three-way join) as if SE_JOIN_ON_LOOP_EDGES_ONLY was zero
+ * for this block (0 means disabled)
+ */
+#define SE_JOIN_ESCALATION_THR              0
+
 /**
  * maximal call depth
  */
 #define SE_MAX_CALL_DEPTH                   0x40
 
+/**
+ * memory budget (in MiB) enforced by the symbolic execution, 0 means unlimited;
+ * can be overridden by the mem_budget option given in the config string
+ */
+#define SE_MEM_BUDGET                       0
+
 /**
  * if non-zero, plot each state that caused an error to be reported
  */
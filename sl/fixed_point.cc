@@ -155,7 +155,7 @@ void loadHeaps(
         TStateList                 *pStateList,
         TInsnLookup                *pInsnLookup,
         const TFnc                  fnc,
-        const TStateMap            &stateMap)
+        TStateMap                  &stateMap)
 {
     typedef WorkList<TBlock> TWorkList;
 
@@ -191,11 +191,12 @@ void loadHeaps(
             // store the reverse mapping from instructions to locations
             (*pInsnLookup)[insn] = locIdx;
 
-            // load heaps if a non-empty fixed-point is available for this loc
-            const TStateMap::const_iterator it = stateMap.find(insn);
+            // move heaps if a non-empty fixed-point is available for this loc
+            const TStateMap::iterator it = stateMap.find(insn);
             if (it != stateMap.end()) {
-                locState->heapList = it->second;
-                Trace::waiveCloneOperation(locState->heapList);
+                // no need to clone the heaps, nobody else is going to use them
+                locState->heapList.swap(it->second);
+                stateMap.erase(it);
             }
 
             // enlarge trace edges vectors
@@ -550,7 +551,7 @@ bool /* found any */ implyContShapesFromTrace(GlobalState &glState)
     return foundAny;
 }
 
-GlobalState* computeStateOf(const TFnc fnc, const TStateMap &stateByInsn)
+GlobalState* computeStateOf(const TFnc fnc, TStateMap &stateByInsn)
 {
     GlobalState *glState = new GlobalState;
 
@@ -155,7 +155,7 @@ class GlobalState {
         GlobalState& operator=(const GlobalState &);
 
         friend GlobalState* computeStateOf(const TFnc,
-                const StateByInsn::TStateMap &);
+                StateByInsn::TStateMap &);
 
         friend void exportControlFlow(GlobalState *pDst,
                 const GlobalState &glState);
@@ -172,8 +172,13 @@ SymHeap *heapByIdent(GlobalState &, THeapIdent);
 /// return shape of the given state by its identity
 const Shape *shapeByIdent(const GlobalState &, const TShapeIdent &);
 
-/// caller is responsible to destroy the returned instance
-GlobalState* computeStateOf(TFnc, const StateByInsn::TStateMap &);
+/**
+ * caller is responsible to destroy the returned instance
+ *
+ * The heaps of the given function are moved (not copied) from stateByInsn to
+ * the returned state and the corresponding entries of stateByInsn are erased.
+ */
+GlobalState* computeStateOf(TFnc, StateByInsn::TStateMap &);
 
 /// write the CFG-only skeleton of glState into *pDst
 void exportControlFlow(GlobalState *pDst, const GlobalState &glState);
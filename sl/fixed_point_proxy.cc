@@ -430,13 +430,21 @@ void StateByInsn::plotAll()
     if (GlConf::data.detectContainers)
         AdtOp::loadDefaultOperations(&adtOps, stor);
 
-    BOOST_FOREACH(TFncMap::const_reference fncItem, d->visitedFncs) {
-        const TFnc fnc = fncItem.second;
+    // the heaps of each function are released as soon as it is plotted, so
+    // that we never keep two copies of the fixed-point in memory at a time
+    while (!d->visitedFncs.empty()) {
+        const TFncMap::iterator it = d->visitedFncs.begin();
+        const TFnc fnc = it->second;
+        d->visitedFncs.erase(it);
+
         const TLoc loc = locationOf(*fnc);
         CL_NOTE_MSG(loc, "plotting fixed-point of " << nameOf(*fnc) << "()...");
 
         plotFnc(fnc, d->stateByInsn);
     }
+
+    // release heaps of the instructions that are not plotted at all
+    d->stateByInsn.clear();
 }
 
 } // namespace FixedPoint
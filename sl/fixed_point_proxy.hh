@@ -43,6 +43,7 @@ namespace FixedPoint {
 
             const TStateMap& stateMap() const;
 
+            /// plot the fixed-point of all visited functions and release it
             void plotAll();
 
         private:
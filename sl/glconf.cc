@@ -117,6 +117,18 @@ void handleJoinOnLoopEdgesOnly(const string &name, const string &value)
     }
 }
 
+void handleJoinEscalationThr(const string &name, const string &value)
+{
+    try {
+        data.joinEscalationThr = boost::lexical_cast<int>(value);
+        if (data.joinEscalationThr < 0)
+            data.joinEscalationThr = 0;
+    }
+    catch (...) {
+        CL_WARN("ignoring option \"" << name << "\" with invalid value");
+    }
+}
+
 void handleStateLiveOrdering(const string &name, const string &value)
 {
     if (value.empty()) {
@@ -147,6 +159,24 @@ void handleIntArithmeticLimit(const string &name, const string &value)
     }
 }
 
+void handleMemBudget(const string &name, const string &value)
+{
+    try {
+        data.memBudget = boost::lexical_cast<int>(value);
+        if (data.memBudget < 0)
+            data.memBudget = 0;
+    }
+    catch (...) {
+        CL_WARN("ignoring option \"" << name << "\" with invalid value");
+    }
+}
+
+void handleAccelerateIntLoops(const string &name, const string &value)
+{
+    assumeNoValue(name, value);
+    data.accelerateIntLoops = true;
+}
+
 void handleAllowCyclicTraceGraph(const string &name, const string &value)
 {
     assumeNoValue(name, value);
@@ -207,6 +237,7 @@ void handleDetectContainers(const string &name, const string &value)
 
 ConfigStringParser::ConfigStringParser()
 {
+    tbl_["accelerate_int_loops"]    = handleAccelerateIntLoops;
     tbl_["allow_cyclic_trace_graph"]= handleAllowCyclicTraceGraph;
     tbl_["allow_three_way_join"]    = handleAllowThreeWayJoin;
     tbl_["dump_fixed_point"]        = handleDumpFixedPoint;
@@ -214,7 +245,9 @@ ConfigStringParser::ConfigStringParser()
     tbl_["error_label"]             = handleErrorLabel;
     tbl_["forbid_heap_replace"]     = handleForbidHeapReplace;
     tbl_["int_arithmetic_limit"]    = handleIntArithmeticLimit;
+    tbl_["join_escalation_thr"]     = handleJoinEscalationThr;
     tbl_["join_on_loop_edges_only"] = handleJoinOnLoopEdgesOnly;
+    tbl_["mem_budget"]              = handleMemBudget;
     tbl_["memleak_is_error"]        = handleMemLeakIsError;
     tbl_["no_error_recovery"]       = handleNoErrorRecovery;
     tbl_["no_plot"]                 = handleNoPlot;
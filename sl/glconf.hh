@@ -41,7 +41,10 @@ struct Options {
     int allowThreeWayJoin;  ///< @copydoc config.h::SE_ALLOW_THREE_WAY_JOIN
     bool forbidHeapReplace; ///< @copydoc config.h::SE_FORBID_HEAP_REPLACE
     int intArithmeticLimit; ///< @copydoc config.h::SE_INT_ARITHMETIC_LIMIT
+    bool accelerateIntLoops;///< @copydoc config.h::SE_ACCELERATE_INT_LOOPS
     int joinOnLoopEdgesOnly;///< @copydoc config.h::SE_JOIN_ON_LOOP_EDGES_ONLY
+    int joinEscalationThr;  ///< @copydoc config.h::SE_JOIN_ESCALATION_THR
+    int memBudget;          ///< @copydoc config.h::SE_MEM_BUDGET
     int stateLiveOrdering;  ///< @copydoc config.h::SE_STATE_ON_THE_FLY_ORDERING
     bool detectContainers;  ///< detect containers and operations over them
     FixedPoint::StateByInsn *fixedPoint;  ///< fixed-point plotter (0 if unused)
@@ -56,7 +59,10 @@ struct Options {
         allowThreeWayJoin(SE_ALLOW_THREE_WAY_JOIN),
         forbidHeapReplace(SE_FORBID_HEAP_REPLACE),
         intArithmeticLimit(SE_INT_ARITHMETIC_LIMIT),
+        accelerateIntLoops(SE_ACCELERATE_INT_LOOPS),
         joinOnLoopEdgesOnly(SE_JOIN_ON_LOOP_EDGES_ONLY),
+        joinEscalationThr(SE_JOIN_ESCALATION_THR),
+        memBudget(SE_MEM_BUDGET),
         stateLiveOrdering(SE_STATE_ON_THE_FLY_ORDERING),
         detectContainers(false),
         fixedPoint(0)
@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of predator.
+ *
+ * predator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * predator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with predator.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#include "membudget.hh"
+
+#include <cl/cl_msg.hh>
+#include <cl/memdebug.hh>
+
+#include "glconf.hh"
+
+#include <cstdio>
+
+#include <unistd.h>
+
+namespace MemBudget {
+
+/// count of check() calls between two samples of the memory usage
+static const int samplingPeriod = 0x100;
+
+static int callsToSample;
+static EPressure level = MP_NONE;
+static bool evict;
+
+/// the options overridden at MP_JOIN level, restored by reset()
+static bool optsSaved;
+static int savedJoinOnLoopEdgesOnly;
+static int savedAllowThreeWayJoin;
+
+/// resident set size of the process, used if currentMemUsage() is unavailable
+static bool rssMemUsage(ssize_t *pDst)
+{
+    FILE *f = fopen("/proc/self/statm", "r");
+    if (!f)
+        return false;
+
+    long size, rss;
+    const bool ok = (2 == fscanf(f, "%ld %ld", &size, &rss));
+    fclose(f);
+    if (!ok)
+        return false;
+
+    *pDst = static_cast<ssize_t>(rss) * sysconf(_SC_PAGESIZE);
+    return true;
+}
+
+static void raiseLevel(const EPressure to, const ssize_t usage)
+{
+    CL_WARN("memory usage " << (usage >> /* MiB */ 20) << " MB is approaching"
+            " the budget of " << GlConf::data.memBudget << " MB, level "
+            << level << " -> " << to);
+
+    if (level < MP_JOIN && MP_JOIN <= to && !GlConf::data.detectContainers) {
+        // join states on each basic block entry, also by three-way join
+        savedJoinOnLoopEdgesOnly            = GlConf::data.joinOnLoopEdgesOnly;
+        savedAllowThreeWayJoin              = GlConf::data.allowThreeWayJoin;
+        optsSaved                           = true;
+        GlConf::data.joinOnLoopEdgesOnly    = 0;
+        GlConf::data.allowThreeWayJoin      = /* unrestricted */ 3;
+    }
+
+    // the other levels are queried by the symbolic execution on the fly
+    level = to;
+}
+
+EPressure check()
+{
+    const int budget = GlConf::data.memBudget;
+    if (!budget || MP_EXCEEDED == level)
+        return level;
+
+    if (0 < callsToSample--)
+        return level;
+
+    callsToSample = samplingPeriod;
+
+    // mallinfo() gives up above 2 GiB, so fall back to RSS in that case
+    ssize_t usage;
+    if (!currentMemUsage(&usage) && !rssMemUsage(&usage))
+        return level;
+
+    const ssize_t limit = static_cast<ssize_t>(budget) << /* MiB */ 20;
+    EPressure to = MP_NONE;
+    if (limit <= usage)
+        to = MP_EXCEEDED;
+    else if (limit / 10 * 9 <= usage)
+        to = MP_CACHE;
+    else if (limit / 4 * 3 <= usage)
+        to = MP_TRACE;
+    else if (limit / 5 * 3 <= usage)
+        to = MP_JOIN;
+
+    if (level < to)
+        raiseLevel(to, usage);
+
+    if (MP_CACHE <= level)
+        evict = true;
+
+    return level;
+}
+
+EPressure pressure()
+{
+    return level;
+}
+
+bool evictionPending()
+{
+    if (!evict)
+        return false;
+
+    evict = false;
+    return true;
+}
+
+void reset()
+{
+    if (optsSaved) {
+        GlConf::data.joinOnLoopEdgesOnly    = savedJoinOnLoopEdgesOnly;
+        GlConf::data.allowThreeWayJoin      = savedAllowThreeWayJoin;
+        optsSaved = false;
+    }
+
+    callsToSample = 0;
+    level = MP_NONE;
+    evict = false;
+}
+
+} // namespace MemBudget
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of predator.
+ *
+ * predator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * predator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with predator.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef H_GUARD_MEM_BUDGET_H
+#define H_GUARD_MEM_BUDGET_H
+
+/**
+ * @file membudget.hh
+ * graceful degradation of the symbolic execution once the memory usage
+ * approaches the budget given by GlConf::Options::memBudget
+ */
+
+namespace MemBudget {
+
+/// the levels are only raised during the run, never lowered again (see reset)
+enum EPressure {
+    MP_NONE = 0,        ///< below 60% of the budget, nothing to do
+    MP_JOIN,            ///< join states on each block entry, three-way join
+    MP_TRACE,           ///< do not record non-terminal insns in trace graphs
+    MP_CACHE,           ///< evict the unused entries of the call cache
+    MP_EXCEEDED         ///< give up the functions being executed
+};
+
+/// sample the memory usage once in a while and raise the level if needed
+EPressure check();
+
+/// the level reached so far
+EPressure pressure();
+
+/// return true once after each sample taken at MP_CACHE (or higher) level
+bool evictionPending();
+
+/// drop the level and restore the options overridden by raising it
+void reset();
+
+} // namespace MemBudget
+
+#endif /* H_GUARD_MEM_BUDGET_H */
@@ -23,6 +23,7 @@
 
 #include <cl/cl_msg.hh>
 #include <cl/clutil.hh>
+#include <cl/perfstats.hh>
 #include <cl/storage.hh>
 
 #include "prototype.hh"
@@ -474,6 +475,7 @@ void abstractIfNeeded(SymHeap &sh)
 #if SE_DISABLE_SLS && SE_DISABLE_DLS
     return;
 #endif
+    PERF_TIMER("sl.abstraction");
     Shape shape;
     while (discoverBestAbstraction(&shape, sh)) {
         if (!applyAbstraction(sh, shape))
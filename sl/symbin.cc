@@ -42,6 +42,7 @@
 #include <cstring>
 #include <libgen.h>
 #include <map>
+#include <vector>
 
 typedef const struct cl_loc     *TLoc;
 typedef const struct cl_operand &TOp;
@@ -944,6 +945,19 @@ class BuiltInTable {
     public:
         typedef const CodeStorage::Insn             &TInsn;
 
+        typedef bool (*THandler)(
+                SymState                            &dst,
+                SymExecCore                         &core,
+                const CodeStorage::Insn             &insn,
+                const char                          *name);
+
+        /// a built-in function resolved for a particular uid of function
+        struct TBuiltIn {
+            THandler                                hdl;
+            const char                              *name;
+            const TOpIdxList                        *derefs;
+        };
+
     public:
         static BuiltInTable* inst() {
             return (inst_)
@@ -951,40 +965,46 @@ class BuiltInTable {
                 : (inst_ = new BuiltInTable);
         }
 
+        void resolve(const CodeStorage::Storage &stor);
+
+        const TBuiltIn* lookup(SymExecCore &core, const struct cl_operand &op);
+
         bool handleBuiltIn(
                 SymState                            &dst,
                 SymExecCore                         &core,
                 TInsn                                insn,
-                const char                          *name)
+                const TBuiltIn                      &bi)
             const;
 
-        const TOpIdxList& lookForDerefs(const char *name) const;
-
         // TODO: rename and hide
         const TOpIdxList                            emp_;
 
     private:
         BuiltInTable();
 
-        static BuiltInTable* inst_;
+        THandler lookForHandler(const char *name) const;
 
-        typedef bool (*THandler)(
-                SymState                            &dst,
-                SymExecCore                         &core,
-                const CodeStorage::Insn             &insn,
-                const char                          *name);
+        const TOpIdxList& lookForDerefs(const char *name) const;
+
+        static BuiltInTable* inst_;
 
         typedef std::map<std::string, THandler>     TMap;
         TMap                                        tbl_;
 
         typedef std::map<std::string, TOpIdxList>   TDerefMap;
         TDerefMap                                   der_;
+
+        /// built-in functions of resStor_ indexed by uid, zero hdl if none
+        typedef std::vector<TBuiltIn>               TResolvedList;
+        TResolvedList                               res_;
+        const CodeStorage::Storage                  *resStor_;
 };
 
 BuiltInTable *BuiltInTable::inst_;
 
 /// register built-ins
-BuiltInTable::BuiltInTable()
+BuiltInTable::BuiltInTable():
+    resStor_(0)
 {
     // GCC built-in stack allocation
     tbl_["__builtin_alloca"] /* before GCC 4.7.0 */ = handleAlloca;
@@ -1044,36 +1064,19 @@ BuiltInTable::BuiltInTable()
     der_["strncpy"]     .push_back(/* src  */ 3);
 }
 
-bool BuiltInTable::handleBuiltIn(
-        SymState                                    &dst,
-        SymExecCore                                 &core,
-        const CodeStorage::Insn                     &insn,
-        const char                                  *name)
-    const
+BuiltInTable::THandler BuiltInTable::lookForHandler(const char *name) const
 {
-    THandler hdl;
-
     TMap::const_iterator it = tbl_.find(name);
-    if (tbl_.end() == it) {
-        static const char namePrefixNondet[] = "__VERIFIER_nondet_";
-        static const size_t namePrefixLength = sizeof(namePrefixNondet) - 1U;
-        std::string namePrefix(name);
-        if (namePrefixLength < namePrefix.size())
-            namePrefix.resize(namePrefixLength);
-
-        if (std::string(namePrefixNondet) == namePrefix)
-            hdl = handleNondetInt;
-        else
-            // no fnc name matched as built-in
-            return false;
-    }
-    else
-        hdl = it->second;
+    if (tbl_.end() != it)
+        return it->second;
 
-    SymHeap &sh = core.sh();
-    sh.traceUpdate(new Trace::InsnNode(sh.traceNode(), &insn, /* bin */ true));
+    static const char namePrefixNondet[] = "__VERIFIER_nondet_";
+    static const size_t namePrefixLength = sizeof(namePrefixNondet) - 1U;
+    if (!strncmp(name, namePrefixNondet, namePrefixLength))
+        return handleNondetInt;
 
-    return hdl(dst, core, insn, name);
+    // no fnc name matched as built-in
+    return 0;
 }
 
 const TOpIdxList& BuiltInTable::lookForDerefs(const char *name) const
@@ -1086,27 +1089,85 @@ const TOpIdxList& BuiltInTable::lookForDerefs(const char *name) const
     return it->second;
 }
 
-bool fncNameFromOp(
-        const char                                **pName,
+/// match the names of all external functions against the built-ins only once
+void BuiltInTable::resolve(const CodeStorage::Storage &stor)
+{
+    res_.clear();
+    resStor_ = &stor;
+
+    const CodeStorage::FncDb &fncs = stor.fncs;
+    for (CodeStorage::FncDb::const_iterator it = fncs.begin();
+            it != fncs.end(); ++it)
+    {
+        const CodeStorage::Fnc &fnc = **it;
+        if (!fnc.def.data.cst.data.cst_fnc.is_extern)
+            // only external functions are candidates for built-in functions
+            continue;
+
+        const char *name = nameOf(fnc);
+        if (!name)
+            continue;
+
+        const THandler hdl = this->lookForHandler(name);
+        if (!hdl)
+            continue;
+
+        const int uid = uidOf(fnc);
+        CL_BREAK_IF(uid < 0);
+        if (res_.size() <= static_cast<unsigned>(uid)) {
+            const TBuiltIn none = { 0, 0, 0 };
+            res_.resize(uid + 1, none);
+        }
+
+        TBuiltIn &bi = res_[uid];
+        bi.hdl      = hdl;
+        bi.name     = name;
+        bi.derefs   = &this->lookForDerefs(name);
+    }
+}
+
+const BuiltInTable::TBuiltIn* BuiltInTable::lookup(
         SymExecCore                                 &core,
         const struct cl_operand                     &op)
 {
     int uid;
     if (!core.fncFromOperand(&uid, op))
-        return false;
+        return 0;
 
     const TStorRef stor = core.sh().stor();
-    const CodeStorage::Fnc *fnc = stor.fncs[uid];
-    if (!fnc->def.data.cst.data.cst_fnc.is_extern)
-        // only external functions are candidates for built-in functions
-        return false;
+    if (&stor != resStor_)
+        // not resolved by resolveBuiltIns() in advance
+        this->resolve(stor);
 
-    const char *name = nameOf(*fnc);
-    if (!name)
-        return false;
+    if (uid < 0 || res_.size() <= static_cast<unsigned>(uid))
+        // not a built-in
+        return 0;
 
-    *pName = name;
-    return true;
+    const TBuiltIn &bi = res_[uid];
+    if (!bi.hdl)
+        // not a built-in
+        return 0;
+
+    return &bi;
+}
+
+bool BuiltInTable::handleBuiltIn(
+        SymState                                    &dst,
+        SymExecCore                                 &core,
+        const CodeStorage::Insn                     &insn,
+        const TBuiltIn                              &bi)
+    const
+{
+    SymHeap &sh = core.sh();
+    sh.traceUpdate(new Trace::InsnNode(sh.traceNode(), &insn, /* bin */ true));
+
+    return bi.hdl(dst, core, insn, bi.name);
+}
+
+void resolveBuiltIns(const CodeStorage::Storage &stor)
+{
+    BuiltInTable *tbl = BuiltInTable::inst();
+    tbl->resolve(stor);
 }
 
 bool handleBuiltIn(
@@ -1114,23 +1175,24 @@ bool handleBuiltIn(
         SymExecCore                                 &core,
         const CodeStorage::Insn                     &insn)
 {
-    const char *name;
-    if (!fncNameFromOp(&name, core, insn.operands[/* fnc */ 1]))
+    BuiltInTable *tbl = BuiltInTable::inst();
+    const BuiltInTable::TBuiltIn *bi =
+        tbl->lookup(core, insn.operands[/* fnc */ 1]);
+    if (!bi)
         return false;
 
-    const BuiltInTable *tbl = BuiltInTable::inst();
-    return tbl->handleBuiltIn(dst, core, insn, name);
+    return tbl->handleBuiltIn(dst, core, insn, *bi);
 }
 
 const TOpIdxList& opsWithDerefSemanticsInCallInsn(
         SymExecCore                                 &core,
         const CodeStorage::Insn                     &insn)
 {
-    const BuiltInTable *tbl = BuiltInTable::inst();
-
-    const char *name;
-    if (!fncNameFromOp(&name, core, insn.operands[/* fnc */ 1]))
+    BuiltInTable *tbl = BuiltInTable::inst();
+    const BuiltInTable::TBuiltIn *bi =
+        tbl->lookup(core, insn.operands[/* fnc */ 1]);
+    if (!bi)
         return tbl->emp_;
 
-    return tbl->lookForDerefs(name);
+    return *bi->derefs;
 }
@@ -32,11 +32,19 @@ class SymState;
 
 namespace CodeStorage {
     struct Insn;
+    struct Storage;
 }
 
 /// list of indexes of operands in an instruction
 typedef std::vector<unsigned /* idx */>         TOpIdxList;
 
+/**
+ * match the functions of the given storage against the built-ins once, so that
+ * the executed call instructions need not be matched by name of the callee
+ * @note the table is resolved on demand if this function has not been called
+ */
+void resolveBuiltIns(const CodeStorage::Storage &stor);
+
 /// list of operands which have dereference semantics for a detected built-in
 const TOpIdxList& opsWithDerefSemanticsInCallInsn(
         SymExecCore                             &core,
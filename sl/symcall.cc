@@ -514,6 +514,26 @@ SymBackTrace& SymCallCache::bt()
     return d->bt;
 }
 
+unsigned SymCallCache::evictUnused()
+{
+    typedef Private::TCache TCache;
+    TCache &cache = d->cache;
+
+    unsigned cnt = 0;
+    for (TCache::iterator it = cache.begin(); it != cache.end();) {
+        if (it->second.inUse()) {
+            // the contexts are referred by the current backtrace
+            ++it;
+            continue;
+        }
+
+        cache.erase(it++);
+        ++cnt;
+    }
+
+    return cnt;
+}
+
 void pullGlVar(SymHeap &result, SymHeap origin, const CVar &cv)
 {
     // do not try to combine things, it causes problems
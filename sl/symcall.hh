@@ -61,6 +61,12 @@ class SymCallCache {
                 const CodeStorage::Fnc       &fnc,
                 const CodeStorage::Insn      &insn);
 
+        /**
+         * drop cached results of all functions that are not being executed
+         * @return count of functions whose cached results have been dropped
+         */
+        unsigned evictUnused();
+
     private:
         /// object copying is @b not allowed
         SymCallCache(const SymCallCache &);
@@ -392,9 +392,10 @@ void splitHeapByCVars(
 #if DEBUG_SYMCUT
     CL_DEBUG("splitHeapByCVars() started: cut by " << cut.size() << " variable(s)");
 #endif
-    // get the set of live program variables
-    DeepCopyData::TCut live;
-    gatherProgramVars(live, *srcDst);
+    // get the complete list of program variables (the heap is traversed once)
+    TCVarList all;
+    gatherProgramVars(all, *srcDst);
+    const DeepCopyData::TCut live(all.begin(), all.end());
 
     // make an intersection with the cut
     DeepCopyData::TCut cset;
@@ -418,10 +419,6 @@ void splitHeapByCVars(
 #if DEBUG_SYMCUT
     CL_DEBUG("splitHeapByCVars() is computing the frame...");
 #endif
-    // get the complete list of program variables
-    TCVarList all;
-    gatherProgramVars(all, *srcDst);
-
     // compute set difference (we cannot use std::set_difference since 'all' is
     // not sorted, which would break the algorithm badly)
     DeepCopyData::TCut complement;
@@ -429,8 +426,9 @@ void splitHeapByCVars(
         if (!hasKey(cset, cv))
             complement.insert(cv);
 
-    // compute the corresponding frame
-    prune(*srcDst, *saveFrameTo, complement);
+    // compute the corresponding frame (unless there is nothing to put there)
+    if (!complement.empty() || srcDst->objEstimatedType(OBJ_RETURN))
+        prune(*srcDst, *saveFrameTo, complement);
 
     // print some statistics
 #if DEBUG_SYMCUT || !defined NDEBUG
@@ -474,7 +472,12 @@ void joinHeapsByCVars(
     // gather _all_ program variables of *src2
     DeepCopyData::TCut cset;
     gatherProgramVars(cset, *src2);
-    
+
+    if (cset.empty() && !src2->objEstimatedType(OBJ_RETURN))
+        // the frame is empty (it contains only objects reachable from program
+        // variables), so there is nothing to merge into *srcDst
+        return;
+
     // forward-only merge of *src2 into *srcDst
     prune(*src2, *srcDst, cset, /* optimization */ true);
 }
@@ -24,10 +24,12 @@
 #include <cl/cldebug.hh>
 #include <cl/clutil.hh>
 #include <cl/memdebug.hh>
+#include <cl/perfstats.hh>
 #include <cl/storage.hh>
 
 #include "fixed_point_proxy.hh"
 #include "glconf.hh"
+#include "membudget.hh"
 #include "sigcatch.hh"
 #include "symabstract.hh"
 #include "symcall.hh"
@@ -119,7 +121,8 @@ class SymExecEngine: public IStatsProvider {
             insnIdx_(0),
             heapIdx_(0),
             waiting_(false),
-            endReached_(false)
+            endReached_(false),
+            gaveUp_(false)
         {
             this->initEngine(entry);
         }
@@ -151,6 +154,7 @@ class SymExecEngine: public IStatsProvider {
         unsigned                        heapIdx_;
         bool                            waiting_;
         bool                            endReached_;
+        bool                            gaveUp_;
 
         SymHeapList                     localState_;
         SymHeapList                     nextLocalState_;
@@ -179,10 +183,12 @@ class SymExecEngine: public IStatsProvider {
                 const TValId                        v1,
                 const TValId                        v2);
 
+        SymHeap& localHeap();
         void execJump();
         void execReturn();
         void execCondInsn();
         void execTermInsn();
+        bool execNontermInsnOn(SymHeap &sh);
         bool execNontermInsn();
         bool execInsn();
         bool execBlock();
@@ -223,15 +229,20 @@ void SymExecEngine::initEngine(const SymHeap &init)
     sched_.schedule(entry);
 }
 
+/// the heap being processed, localState_ is not going to use it any more
+SymHeap& SymExecEngine::localHeap()
+{
+    CL_BREAK_IF(localState_.size() <= heapIdx_);
+    return **(localState_.begin() + heapIdx_);
+}
+
 void SymExecEngine::execJump()
 {
     const CodeStorage::Insn *insn = block_->operator[](insnIdx_);
     const CodeStorage::TTargetList &tlist = insn->targets;
 
-    // make a copy in case we needed to perform an abstraction
-    const SymHeap &origin = localState_[heapIdx_];
-    SymHeap sh(origin);
-    Trace::waiveCloneOperation(sh);
+    // the heap is not needed in localState_ any more, update it in place
+    SymHeap &sh = this->localHeap();
 
     this->updateState(sh, tlist[/* target */ 0]);
 }
@@ -242,11 +253,10 @@ void SymExecEngine::execReturn()
     const CodeStorage::TOperandList &opList = insn->operands;
     CL_BREAK_IF(1 != opList.size());
 
-    // create a local copy of the heap
-    const SymHeap &origin = localState_[heapIdx_];
-    SymHeap sh(origin);
+    // the heap is not needed in localState_ any more, update it in place
+    SymHeap &sh = this->localHeap();
 
-    Trace::Node *trOrig = origin.traceNode();
+    Trace::Node *trOrig = sh.traceNode();
     Trace::Node *trRet = new Trace::InsnNode(trOrig, insn, /* bin */ false);
     sh.traceUpdate(trRet);
 
@@ -275,7 +285,7 @@ void SymExecEngine::execReturn()
     }
 
     // commit one of the function results
-    dst_.insert(sh);
+    dst_.adopt(sh);
     endReached_ = true;
 }
 
@@ -560,7 +570,7 @@ void SymExecEngine::execTermInsn()
     }
 }
 
-bool /* handled */ SymExecEngine::execNontermInsn()
+bool /* handled */ SymExecEngine::execNontermInsnOn(SymHeap &sh)
 {
     const CodeStorage::Insn *insn = block_->operator[](insnIdx_);
 
@@ -572,14 +582,9 @@ bool /* handled */ SymExecEngine::execNontermInsn()
     ep.errLabel         = GlConf::data.errLabel;
 
     // working area for non-terminal instructions
-    const SymHeap &origin = localState_[heapIdx_];
-    SymHeap sh(origin);
     SymExecCore core(sh, &bt_, ep);
     core.setLocation(lw_);
 
-    // drop the unnecessary Trace::CloneNode node in the trace graph
-    Trace::waiveCloneOperation(sh);
-
     // execute the instruction
     if (!core.exec(nextLocalState_, *insn)) {
         CL_BREAK_IF(CL_INSN_CALL != insn->code);
@@ -594,6 +599,23 @@ bool /* handled */ SymExecEngine::execNontermInsn()
     return /* insn handled */ true;
 }
 
+bool /* handled */ SymExecEngine::execNontermInsn()
+{
+    const CodeStorage::Insn *insn = block_->operator[](insnIdx_);
+    if (CL_INSN_CALL != insn->code)
+        // the heap is not needed in localState_ any more, so the result is
+        // moved from localState_ to nextLocalState_ without being copied
+        return this->execNontermInsnOn(this->localHeap());
+
+    // callEntry() may still refer to the heap in localState_, use a copy
+    SymHeap sh(localState_[heapIdx_]);
+
+    // drop the unnecessary Trace::CloneNode node in the trace graph
+    Trace::waiveCloneOperation(sh);
+
+    return this->execNontermInsnOn(sh);
+}
+
 bool /* complete */ SymExecEngine::execInsn()
 {
     const CodeStorage::Insn *insn = block_->operator[](insnIdx_);
@@ -654,6 +676,7 @@ bool /* complete */ SymExecEngine::execInsn()
 
         // time to respond to a single pending signal
         this->processPendingSignals();
+        MemBudget::check();
 
         if (isTerm) {
             // terminal insn
@@ -696,6 +719,9 @@ bool /* complete */ SymExecEngine::execBlock()
         const SymState &origin = stateMap_[block_];
         localState_ = origin;
 
+        PERF_COUNT("sl.blocks_executed", 1);
+        PERF_SAMPLE("sl.heaps_per_block", localState_.size());
+
         // eliminate the unneeded Trace::CloneNode instances
         Trace::waiveCloneOperation(localState_);
     }
@@ -783,6 +809,12 @@ bool /* complete */ SymExecEngine::run()
 
     // main loop of SymExecEngine
     while (sched_.getNext(&block_)) {
+        if (MemBudget::MP_EXCEEDED <= MemBudget::check()) {
+            // keep the results computed so far, but do not go any further
+            gaveUp_ = true;
+            break;
+        }
+
         // update location info and ptracer
         const CodeStorage::Insn *first = block_->front();
         lw_ = &first->loc;
@@ -804,7 +836,11 @@ bool /* complete */ SymExecEngine::run()
     int debugFixedPoint = (DEBUG_SE_FIXED_POINT);
 
     const struct cl_loc *loc = locationOf(fnc);
-    if (!endReached_) {
+    if (gaveUp_) {
+        CL_WARN_MSG(loc, "memory budget exceeded, results of "
+                << nameOf(fnc) << "() are incomplete");
+    }
+    else if (!endReached_) {
         CL_WARN_MSG(loc, "end of function "
                 << nameOf(fnc) << "() has not been reached");
 #if DEBUG_SE_END_NOT_REACHED
@@ -814,6 +850,18 @@ bool /* complete */ SymExecEngine::run()
         bt_.printBackTrace();
     }
 
+    if (GlConf::data.joinEscalationThr) {
+        // report the blocks whose join policy has been escalated
+        BOOST_FOREACH(const CodeStorage::Block *bb, fnc.cfg) {
+            if (!stateMap_.joinEscalated(bb))
+                continue;
+
+            CL_NOTE_MSG(&bb->front()->loc, "___ block " << bb->name()
+                    << " ends up with " << stateMap_[bb].size()
+                    << " heap(s), its join policy has been escalated");
+        }
+    }
+
     // we are done with this function
     CL_DEBUG_MSG(loc, "<<< leaving " << nameOf(fnc) << "()");
     waiting_ = false;
@@ -839,11 +887,15 @@ void SymExecEngine::printStatsHelper(const BlockScheduler::TBlock bb) const
         ? " in progress"
         : " scheduled";
 
+    const char *suffix = (stateMap_.joinEscalated(bb))
+        ? " [join escalated]"
+        : "";
+
     const CodeStorage::Insn *first = bb->front();
     CL_NOTE_MSG(&first->loc,
             "___ block " << name << status <<
             ", " << total << " heap(s) total"
-            ", " << waiting << " heap(s) pending");
+            ", " << waiting << " heap(s) pending" << suffix);
 }
 
 void SymExecEngine::printStats() const
@@ -1167,6 +1219,12 @@ void SymExec::execFnc(
         const ExecStackItem &item = execStack_.front();
         SymExecEngine *engine = item.eng;
 
+        if (MemBudget::evictionPending()) {
+            const unsigned cnt = callCache_.evictUnused();
+            CL_DEBUG("memory budget: evicted call cache of " << cnt
+                    << " function(s)");
+        }
+
         // do as much as we can at the current call level
         if (engine->run()) {
             printMemUsage("SymExecEngine::run");
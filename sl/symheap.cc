@@ -71,17 +71,6 @@ class NeqDb: public SymPairSet<TValId, /* IREFLEXIVE */ true> {
         RefCounter refCnt;
 
     public:
-        template <class TDst>
-        void gatherRelatedValues(TDst &dst, TValId val) const {
-            // FIXME: suboptimal due to performance
-            BOOST_FOREACH(const TItem &item, cont_) {
-                if (item.first == val)
-                    dst.push_back(item.second);
-                else if (item.second == val)
-                    dst.push_back(item.first);
-            }
-        }
-
         friend void SymHeapCore::copyRelevantPreds(
                 SymHeapCore             &dst,
                 const TValMap           &vMap)
@@ -99,19 +88,6 @@ class NeqDb: public SymPairSet<TValId, /* IREFLEXIVE */ true> {
 class CoincidenceDb: public SymPairMap</* v1, v2 */ TValId, TValId /* sum */> {
     public:
         RefCounter refCnt;
-
-    public:
-        template <class TDst>
-        void gatherRelatedValues(TDst &dst, TValId val) const {
-            // FIXME: suboptimal due to performance
-            BOOST_FOREACH(TMap::const_reference ref, db_) {
-                const TItem &item = ref.first;
-                if (item.first == val)
-                    dst.push_back(item.second);
-                else if (item.second == val)
-                    dst.push_back(item.first);
-            }
-        }
 };
 
 // /////////////////////////////////////////////////////////////////////////////
@@ -696,6 +672,9 @@ struct SymHeapCore::Private {
 
     TValId shiftCustomValue(TValId val, TOffset shift);
 
+    /// existing CV_INT_RANGE value of the given anchor/offset/range if any
+    TValId customValueByOffset(TValId anchor, TOffset off, const IR::Range &);
+
     TValId wrapIntVal(const IR::TInt);
 
     void replaceRngByInt(const InternalCustomValue *valData);
@@ -743,14 +722,14 @@ bool /* wasPtr */ SymHeapCore::Private::releaseValueOf(TFldId fld, TValId val)
     if (1 != usedBy.erase(fld))
         CL_BREAK_IF("SymHeapCore::Private::releaseValueOf(): offset detected");
 
-    if (usedBy.empty()) {
-        // kill all related Neq predicates
+    if (usedBy.empty() && this->neqDb->chkAny(val)) {
+        // kill all related Neq predicates at once
+        RefCntLib<RCO_NON_VIRT>::requireExclusivity(this->neqDb);
+
         TValList neqs;
-        this->neqDb->gatherRelatedValues(neqs, val);
-        BOOST_FOREACH(const TValId valNeq, neqs) {
-            CL_DEBUG("releaseValueOf() kills an orphan Neq predicate");
-            this->neqDb->del(valNeq, val);
-        }
+        this->neqDb->delAll(neqs, val);
+        CL_DEBUG("releaseValueOf() kills " << neqs.size()
+                << " orphan Neq predicate(s)");
     }
 
     const EValueTarget code = valData->code;
@@ -2193,12 +2172,19 @@ TValId SymHeapCore::Private::shiftCustomValue(TValId ref, TOffset shift)
     const IR::Range rngRef = rngFromCustom(customDataRef->customData);
     const CustomValue cv(rngRef + IR::rngFromNum(shift));
 
-    // create a new CV_INT_RANGE custom value (do not recycle existing)
+    // reuse the anchor or its dependent value with the same offset if any
+    const TValId anchor = customDataRef->anchor;
+    const TOffset off = customDataRef->offRoot + shift;
+    const TValId valFound = this->customValueByOffset(anchor, off, cv.rng());
+    if (VAL_INVALID != valFound)
+        return valFound;
+
+    // create a new CV_INT_RANGE custom value
     const TValId val = this->valCreate(VT_CUSTOM, VO_ASSIGNED);
     InternalCustomValue *customData;
     this->ents.getEntRW(&customData, val);
-    customData->anchor      = customDataRef->anchor;
-    customData->offRoot     = customDataRef->offRoot + shift;
+    customData->anchor      = anchor;
+    customData->offRoot     = off;
     customData->customData  = cv;
 
     // register this value as a dependent value by the anchor
@@ -2210,6 +2196,31 @@ TValId SymHeapCore::Private::shiftCustomValue(TValId ref, TOffset shift)
     return val;
 }
 
+TValId SymHeapCore::Private::customValueByOffset(
+        const TValId                anchor,
+        const TOffset               off,
+        const IR::Range            &rng)
+{
+    const InternalCustomValue *anchorData;
+    this->ents.getEntRO(&anchorData, anchor);
+    if (!off)
+        // the anchor itself, unless it has been reduced to CV_INT meanwhile
+        return (anchorData->customData.rng() == rng)
+            ? anchor
+            : VAL_INVALID;
+
+    // CV_INT_RANGE values reduced to CV_INT are no longer listed as dependent
+    BOOST_FOREACH(const TValId depVal, anchorData->dependentValues) {
+        const InternalCustomValue *depData;
+        this->ents.getEntRO(&depData, depVal);
+        if (off == depData->offRoot && rng == depData->customData.rng())
+            return depVal;
+    }
+
+    // not found
+    return VAL_INVALID;
+}
+
 TValId SymHeapCore::Private::wrapIntVal(const IR::TInt num)
 {
     if (IR::Int0 == num)
@@ -2843,12 +2854,13 @@ void SymHeapCore::valReplace(TValId val, TValId replaceBy)
     const BaseValue *valData;
     d->ents.getEntRO(&valData, val);
 
-    // kill all related Neq predicates
-    TValList neqs;
-    d->neqDb->gatherRelatedValues(neqs, val);
-    BOOST_FOREACH(const TValId valNeq, neqs) {
-        CL_BREAK_IF(valNeq == replaceBy);
-        this->delNeq(valNeq, val);
+    if (d->neqDb->chkAny(val)) {
+        // kill all related Neq predicates at once
+        RefCntLib<RCO_NON_VIRT>::requireExclusivity(d->neqDb);
+
+        TValList neqs;
+        d->neqDb->delAll(neqs, val);
+        CL_BREAK_IF(neqs.end() != std::find(neqs.begin(), neqs.end(), replaceBy));
     }
 
     // we intentionally do not use a reference here (tight loop otherwise)
@@ -2893,6 +2905,9 @@ void SymHeapCore::copyRelevantPreds(SymHeapCore &dst, const TValMap &valMap)
     BOOST_FOREACH(const NeqDb::TItem &item, d->neqDb->cont_) {
         TValId valLt = item.first;
         TValId valGt = item.second;
+        if (valGt < valLt)
+            // the mirrored item of a pair
+            continue;
 
         if (!translateValId(&valLt, dst, *this, valMap))
             // not relevant
@@ -2911,6 +2926,9 @@ void SymHeapCore::copyRelevantPreds(SymHeapCore &dst, const TValMap &valMap)
     BOOST_FOREACH(CoincidenceDb::const_reference ref, coinDb) {
         TValId valLt = ref/* key */.first/* lt */.first;
         TValId valGt = ref/* key */.first/* gt */.second;
+        if (valGt < valLt)
+            // the mirrored item of a pair
+            continue;
 
         if (!translateValId(&valLt, dst, *this, valMap))
             // not relevant
@@ -2939,6 +2957,9 @@ bool SymHeapCore::matchPreds(
     BOOST_FOREACH(const NeqDb::TItem &item, d->neqDb->cont_) {
         TValId valLt = item.first;
         TValId valGt = item.second;
+        if (valGt < valLt)
+            // the mirrored item of a pair
+            continue;
 
         if (nonZeroOnly && VAL_NULL == valLt)
             continue;
@@ -2961,6 +2982,9 @@ bool SymHeapCore::matchPreds(
     BOOST_FOREACH(CoincidenceDb::const_reference ref, coinDb) {
         TValId valLt = ref/* key */.first/* lt */.first;
         TValId valGt = ref/* key */.first/* gt */.second;
+        if (valGt < valLt)
+            // the mirrored item of a pair
+            continue;
 
         if (!translateValId(&valLt, dst, *this, valMap))
             // failed to translate value ID, better to give up
@@ -23,6 +23,7 @@
 #include <cl/cl_msg.hh>
 #include <cl/cldebug.hh>
 #include <cl/clutil.hh>
+#include <cl/perfstats.hh>
 
 #include "glconf.hh"
 #include "prototype.hh"
@@ -588,16 +589,34 @@ bool joinCustomValues(
     // compute the resulting range that covers both
     IR::Range rng = join(rng1, rng2);
 
-    if (GlConf::data.intArithmeticLimit) {
+    // a pair of distinct constants, e.g. a counter at the head of a loop
+    const bool accelerate = GlConf::data.accelerateIntLoops
+        && !ctx.joiningData()
+        && isSingular(rng1) && isSingular(rng2);
+
+    if (GlConf::data.intArithmeticLimit && !accelerate) {
         const IR::TInt max = std::max(std::abs(rng.lo), std::abs(rng.hi));
         if (max <= GlConf::data.intArithmeticLimit)
             // integral values preserved by SE_INT_ARITHMETIC_LIMIT
             return false;
     }
 
+    if (accelerate) {
+        // sh1 holds the old state, widen in the direction the value evolves
+        // (this intentionally overrides the 0x1 bit of SE_ALLOW_INT_RANGES)
+#if (SE_ALLOW_INT_RANGES & 0x2)
+        if (rng1.lo < rng2.lo)
+            rng.hi = IR::IntMax;
+#endif
+#if (SE_ALLOW_INT_RANGES & 0x4)
+        if (rng2.lo < rng1.lo)
+            rng.lo = IR::IntMin;
+#endif
+    }
+
 #if !(SE_ALLOW_INT_RANGES & 0x1)
     // avoid creation of a CV_INT_RANGE value from two CV_INT values
-    if (isSingular(rng1) && isSingular(rng2)) {
+    if (!accelerate && isSingular(rng1) && isSingular(rng2)) {
         // force three-way join in order not to loop forever!
         ctx.forceThreeWay = true;
         if (!updateJoinStatus(ctx, JS_THREE_WAY))
@@ -2556,6 +2575,7 @@ bool joinSymHeaps(
         SymHeap                  sh2,
         const bool               allowThreeWay)
 {
+    PERF_TIMER("sl.join");
     SJ_DEBUG("--> joinSymHeaps()");
     TStorRef stor = sh1.stor();
     CL_BREAK_IF(&stor != &sh2.stor());
@@ -1215,6 +1215,9 @@ class NeqPlotter: public SymPairSet<TValId, /* IREFLEXIVE */ true> {
             BOOST_FOREACH(const TItem &item, cont_) {
                 const TValId v1 = item.first;
                 const TValId v2 = item.second;
+                if (v2 < v1)
+                    // the mirrored item of a pair
+                    continue;
 
                 if (VAL_NULL == v1)
                     plotNeqZero(plot, v2);
@@ -23,15 +23,36 @@
 #include "config.h"
 #include "util.hh"
 
-#include <map>
-#include <set>
+#include <algorithm>
+#include <vector>
+
+/// compare items of a flat pair store by their first component only
+template <class TKey, class TItem>
+struct FirstOfPairLess {
+    bool operator()(const TItem &item, const TKey &key) const {
+        return item.first < key;
+    }
+
+    bool operator()(const TKey &key, const TItem &item) const {
+        return key < item.first;
+    }
+};
 
-/// a symmetric relation
+/**
+ * a symmetric relation, kept as a flat sorted vector of pairs
+ *
+ * Each pair is stored in both orientations, so that all keys related to a
+ * given key form a contiguous run.  Walk only the items with first <= second
+ * to see each pair once.  The store is copied on write together with the heap
+ * that owns it, so a flat vector (a single allocation) beats a node-based
+ * container here for the sizes we usually see (tens of predicates).
+ */
 template <class TKey, bool IREFLEXIVE>
 class SymPairSet {
     protected:
-        typedef std::pair<TKey /* lt */, TKey /* gt */>     TItem;
-        typedef std::set<TItem>                             TCont;
+        typedef std::pair<TKey, TKey /* related key */>     TItem;
+        typedef std::vector<TItem>                          TCont;
+        typedef FirstOfPairLess<TKey, TItem>                TKeyLess;
         TCont cont_;
 
     public:
@@ -40,39 +61,117 @@ class SymPairSet {
         }
 
         bool chk(TKey k1, TKey k2) const {
-            sortValues(k1, k2);
             const TItem item(k1, k2);
-            return hasKey(cont_, item);
+            return std::binary_search(cont_.begin(), cont_.end(), item);
+        }
+
+        /// return true if the given key is related to any key
+        bool chkAny(TKey key) const {
+            return std::binary_search(cont_.begin(), cont_.end(), key,
+                    TKeyLess());
         }
 
         bool add(TKey k1, TKey k2) {
             CL_BREAK_IF(IREFLEXIVE && k1 == k2);
 
-            sortValues(k1, k2);
-            const TItem item(k1, k2);
-            return cont_.insert(item)./* inserted */second;
+            if (!this->addOne(TItem(k1, k2)))
+                return false;
+
+            if (k1 != k2)
+                this->addOne(TItem(k2, k1));
+
+            return true;
         }
 
         bool del(TKey k1, TKey k2) {
             CL_BREAK_IF(IREFLEXIVE && k1 == k2);
 
-            sortValues(k1, k2);
-            const TItem item(k1, k2);
-            return !!cont_.erase(item);
+            if (!this->delOne(TItem(k1, k2)))
+                return false;
+
+            if (k1 != k2)
+                this->delOne(TItem(k2, k1));
+
+            return true;
+        }
+
+        /// drop all pairs of the given key, append the related keys to dst
+        template <class TDst>
+        void delAll(TDst &dst, TKey key) {
+            const typename TCont::iterator beg = std::lower_bound(
+                    cont_.begin(), cont_.end(), key, TKeyLess());
+            typename TCont::iterator end = beg;
+            for (; cont_.end() != end && key == end->first; ++end)
+                dst.push_back(end->second);
+
+            const size_t cnt = end - beg;
+            cont_.erase(beg, end);
+
+            // drop the mirrored items
+            const typename TDst::const_iterator nbs = dst.end() - cnt;
+            for (typename TDst::const_iterator it = nbs; dst.end() != it; ++it)
+                if (key != *it)
+                    this->delOne(TItem(*it, key));
+        }
+
+        /// append all keys related to the given one to dst, in ascending order
+        template <class TDst>
+        void gatherRelatedValues(TDst &dst, TKey key) const {
+            typename TCont::const_iterator it = std::lower_bound(
+                    cont_.begin(), cont_.end(), key, TKeyLess());
+            for (; cont_.end() != it && key == it->first; ++it)
+                dst.push_back(it->second);
+        }
+
+    private:
+        bool addOne(const TItem &item) {
+            const typename TCont::iterator it =
+                std::lower_bound(cont_.begin(), cont_.end(), item);
+
+            if (cont_.end() != it && item == *it)
+                return false;
+
+            cont_.insert(it, item);
+            return true;
+        }
+
+        bool delOne(const TItem &item) {
+            const typename TCont::iterator it =
+                std::lower_bound(cont_.begin(), cont_.end(), item);
+
+            if (cont_.end() == it || item != *it)
+                return false;
+
+            cont_.erase(it);
+            return true;
         }
 };
 
+/// a symmetric map, kept as a flat sorted vector like SymPairSet
 template <class TKey, class TVal>
 class SymPairMap {
     protected:
-        typedef std::pair<TKey /* lt */, TKey /* gt */>     TItem;
-        typedef std::map<TItem, TVal>                       TMap;
-        TMap db_;
+        typedef std::pair<TKey, TKey /* related key */>     TKeyPair;
+        typedef std::pair<TKeyPair, TVal>                   TItem;
+        typedef std::vector<TItem>                          TCont;
+        typedef FirstOfPairLess<TKeyPair, TItem>            TPairLess;
+        TCont db_;
+
+        /// compare items by the first key of their pair only
+        struct TKeyLess {
+            bool operator()(const TItem &item, const TKey &key) const {
+                return item.first.first < key;
+            }
+
+            bool operator()(const TKey &key, const TItem &item) const {
+                return key < item.first.first;
+            }
+        };
 
     public:
         // for compatibility with STL and Boost libraries
-        typedef typename TMap::const_iterator               const_iterator;
-        typedef typename TMap::const_reference              const_reference;
+        typedef typename TCont::const_iterator              const_iterator;
+        typedef typename TCont::const_reference             const_reference;
 
         /// return STL-like iterator to go through the container
         const_iterator begin() const { return db_.begin(); }
@@ -82,24 +181,47 @@ class SymPairMap {
 
     public:
         void add(TKey k1, TKey k2, TVal val) {
-            sortValues(k1, k2);
-            const TItem key(k1, k2);
+            CL_BREAK_IF(this->find(TKeyPair(k1, k2)) != db_.end());
+            this->addOne(TKeyPair(k1, k2), val);
+            if (k1 != k2)
+                this->addOne(TKeyPair(k2, k1), val);
+        }
 
-            CL_BREAK_IF(hasKey(db_, key));
-            db_[key] = val;
+        /// append all keys related to the given one to dst, in ascending order
+        template <class TDst>
+        void gatherRelatedValues(TDst &dst, TKey key) const {
+            const_iterator it = std::lower_bound(
+                    db_.begin(), db_.end(), key, TKeyLess());
+            for (; db_.end() != it && key == it->first.first; ++it)
+                dst.push_back(it->first.second);
         }
 
         bool chk(TVal *pDst, TKey k1, TKey k2) const {
-            sortValues(k1, k2);
-            const TItem key(k1, k2);
-
-            typename TMap::const_iterator it = db_.find(key);
+            const const_iterator it = this->find(TKeyPair(k1, k2));
             if (db_.end() == it)
                 return false;
 
             *pDst = it->second;
             return true;
         }
+
+    private:
+        const_iterator find(const TKeyPair &key) const {
+            const const_iterator it =
+                std::lower_bound(db_.begin(), db_.end(), key, TPairLess());
+
+            if (db_.end() == it || key != it->first)
+                return db_.end();
+
+            return it;
+        }
+
+        void addOne(const TKeyPair &key, const TVal val) {
+            const typename TCont::iterator it =
+                std::lower_bound(db_.begin(), db_.end(), key, TPairLess());
+
+            db_.insert(it, TItem(key, val));
+        }
 };
 
 #endif /* H_GUARD_SYM_PRED_H */
@@ -27,6 +27,7 @@
 #include <cl/storage.hh>
 
 #include "glconf.hh"
+#include "membudget.hh"
 #include "prototype.hh"
 #include "symabstract.hh"
 #include "symbin.hh"
@@ -2006,6 +2007,66 @@ inline bool handleRangeByScalarPlus(
     return true;
 }
 
+/// return the operand that an integral operation leaves as it is, if any
+TValId identityOperand(
+        const enum cl_binop_e       code,
+        const TValId                v1,
+        const TValId                v2,
+        const IR::Range            &rng1,
+        const IR::Range            &rng2)
+{
+    const bool isZero1 = (IR::rngFromNum(IR::Int0) == rng1);
+    const bool isZero2 = (IR::rngFromNum(IR::Int0) == rng2);
+    const bool isOne1  = (IR::rngFromNum(IR::Int1) == rng1);
+    const bool isOne2  = (IR::rngFromNum(IR::Int1) == rng2);
+
+    switch (code) {
+        case CL_BINOP_PLUS:
+            if (isZero1)
+                return v2;
+            // fall through!
+
+        case CL_BINOP_MINUS:
+        case CL_BINOP_LSHIFT:
+        case CL_BINOP_RSHIFT:
+            return (isZero2) ? v1 : VAL_INVALID;
+
+        case CL_BINOP_MULT:
+            if (isOne1)
+                return v2;
+            // fall through!
+
+        case CL_BINOP_TRUNC_DIV:
+            return (isOne2) ? v1 : VAL_INVALID;
+
+        case CL_BINOP_MIN:
+        case CL_BINOP_MAX:
+            return (v1 == v2) ? v1 : VAL_INVALID;
+
+        default:
+            return VAL_INVALID;
+    }
+}
+
+/// if the operation leaves an integral operand as it is, reuse the operand
+bool handleIdentityOp(
+        TValId                     *pResult,
+        SymHeapCore                &sh,
+        const enum cl_binop_e       code,
+        const TValId                v1,
+        const TValId                v2,
+        const IR::Range            &rng1,
+        const IR::Range            &rng2)
+{
+    const TValId val = identityOperand(code, v1, v2, rng1, rng2);
+    if (VAL_NULL != val && VT_CUSTOM != sh.valTarget(val))
+        // not found, or an offset of NULL that we do not want as the result
+        return false;
+
+    *pResult = val;
+    return true;
+}
+
 bool handleRangeBitMask(
         TValId                     *pResult,
         SymHeapCore                &sh,
@@ -2053,6 +2114,10 @@ TValId handleIntegralOp(
     IR::Range rng1, rng2;
     if (rngFromVal(&rng1, sh, v1) && rngFromVal(&rng2, sh, v2)) {
 
+        // avoid creating a new value if an operand can be used as the result
+        if (handleIdentityOp(&result, sh, code, v1, v2, rng1, rng2))
+            return result;
+
         // first try to preserve range coincidence if we can
         switch (code) {
             case CL_BINOP_BIT_AND:
@@ -2462,10 +2527,16 @@ bool SymExecCore::execCore(
     // kill variables
     this->killInsn(insn);
 
-    Trace::Node *trOrig = sh_.traceNode();
-    Trace::Node *trInsn = new Trace::InsnNode(trOrig, &insn, /* bin */ false);
-    sh_.traceUpdate(trInsn);
-    dst.insert(sh_);
+    if (MemBudget::pressure() < MemBudget::MP_TRACE) {
+        // memory budget permitting, record the insn in the trace graph
+        Trace::Node *trOrig = sh_.traceNode();
+        Trace::Node *trInsn =
+            new Trace::InsnNode(trOrig, &insn, /* bin */ false);
+        sh_.traceUpdate(trInsn);
+    }
+
+    // the managed heap is not needed any more, move it to the results
+    dst.adopt(sh_);
     return true;
 }
 
@@ -229,6 +229,8 @@ class SymExecCore: public SymProc {
          * @return true, if the requested instruction has been processed; false
          * if the instruction has to be processed elsewhere (usually
          * CL_INSN_CALL)
+         * @note the managed symbolic heap may be moved into @b dst, so it
+         * should not be used once the instruction has been processed
          */
         bool exec(SymState &dst, const CodeStorage::Insn &insn);
 
@@ -21,6 +21,7 @@
 #include "symstate.hh"
 
 #include <cl/cl_msg.hh>
+#include <cl/perfstats.hh>
 #include <cl/storage.hh>
 
 #include "glconf.hh"
@@ -108,6 +109,16 @@ void SymState::insertNew(const SymHeap &sh)
     heaps_.push_back(dup);
 }
 
+void SymState::adoptNew(SymHeap &sh)
+{
+    // steal the contents of the given heap, no Trace::CloneNode is created
+    SymHeap *dup = new SymHeap(sh.stor(), sh.traceNode());
+    dup->swap(sh);
+
+    // append the pointer to our container
+    heaps_.push_back(dup);
+}
+
 bool SymState::insert(const SymHeap &sh, bool /* allowThreeWay */ )
 {
     if (-1 != this->lookup(sh))
@@ -266,6 +277,8 @@ void SymStateWithJoin::packState(unsigned idxNew, bool allowThreeWay)
 
 bool SymStateWithJoin::insert(const SymHeap &shNew, bool allowThreeWay)
 {
+    PERF_TIMER("sl.state_lookup");
+
     if ((1 < GlConf::data.joinOnLoopEdgesOnly) && !allowThreeWay)
         // we are asked not to check for entailment, only isomorphism
         return SymHeapUnion::insert(shNew, allowThreeWay);
@@ -563,9 +576,11 @@ struct SymStateMap::Private {
     struct BlockState {
         SymStateMarked                  state;
         bool                            anyHit;
+        bool                            escalated;
 
         BlockState():
-            anyHit(false)
+            anyHit(false),
+            escalated(false)
         {
         }
     };
@@ -591,15 +606,28 @@ SymStateMarked& SymStateMap::operator[](const CodeStorage::Block *bb)
 bool SymStateMap::insert(
         const CodeStorage::Block        *dst,
         const SymHeap                   &sh,
-        const bool                      allowThreeWay)
+        bool                            allowThreeWay)
 {
     // look for the _target_ block
     Private::BlockState &ref = d->cont[dst];
     const unsigned size = ref.state.size();
 
+    // escalate the join policy of this block if it holds too many heaps
+    const int thr = GlConf::data.joinEscalationThr;
+    if (thr && !ref.escalated && static_cast<unsigned>(thr) <= size) {
+        CL_NOTE_MSG(&dst->front()->loc, "___ block " << dst->name()
+                << " holds " << size << " heaps, escalating its join policy");
+
+        ref.escalated = true;
+    }
+
+    if (ref.escalated)
+        // join on each entry of the block, as if joinOnLoopEdgesOnly was 0
+        allowThreeWay = true;
+
     // insert the given symbolic heap
     bool changed = true;
-    if ((2 < GlConf::data.joinOnLoopEdgesOnly)
+    if (!ref.escalated && (2 < GlConf::data.joinOnLoopEdgesOnly)
         && (1 == dst->inbound().size() && (cl_is_term_insn(dst->front()->code)
                 || (CL_INSN_COND == dst->back()->code && 2 == dst->size()))))
     {
@@ -621,6 +649,11 @@ bool SymStateMap::anyReuseHappened(const CodeStorage::Block *bb) const
     return d->cont[bb].anyHit;
 }
 
+bool SymStateMap::joinEscalated(const CodeStorage::Block *bb) const
+{
+    return d->cont[bb].escalated;
+}
+
 int SymStateMap::cntPending(const CodeStorage::Block *bb) const
 {
     return d->cont[bb].state.cntPending();
@@ -65,6 +65,16 @@ class SymState {
         /// insert given SymHeap object into the state
         virtual bool insert(const SymHeap &sh, bool allowThreeWay = true);
 
+        /**
+         * insert given SymHeap object into the state, its contents may be moved
+         * into the container instead of being copied
+         * @param sh a symbolic heap that is no longer needed by the caller, it
+         * is left in a valid but unspecified state
+         */
+        virtual bool adopt(SymHeap &sh, bool allowThreeWay = true) {
+            return this->insert(sh, allowThreeWay);
+        }
+
         /// return count of object stored in the container
         size_t size()          const { return heaps_.size();  }
 
@@ -89,6 +99,9 @@ class SymState {
         /// insert @b new SymHeap that @ must be guaranteed to be not yet in
         virtual void insertNew(const SymHeap &sh);
 
+        /// move the contents of @b new SymHeap into the container
+        void adoptNew(SymHeap &sh);
+
         virtual void eraseExisting(int nth) {
             delete heaps_[nth];
             heaps_.erase(heaps_.begin() + nth);
@@ -130,6 +143,11 @@ class SymHeapList: public SymState {
         virtual int lookup(const SymHeap &) const {
             return /* not found */ -1;
         }
+
+        virtual bool adopt(SymHeap &sh, bool /* allowThreeWay */ = true) {
+            this->adoptNew(sh);
+            return true;
+        }
 };
 
 /**
@@ -281,6 +299,10 @@ class SymStateMap: public IPendingCountProvider {
         /// true if the specified block has ever joined/entailed any given state
         bool anyReuseHappened(const CodeStorage::Block *) const;
 
+        /// true if the join policy of the block has been escalated, see
+        /// config.h::SE_JOIN_ESCALATION_THR
+        bool joinEscalated(const CodeStorage::Block *) const;
+
         virtual int cntPending(const CodeStorage::Block *) const;
 
     private:
@@ -0,0 +1,12 @@
+int main()
+{
+    int i;
+    for (i = 0; i < 1000000; ++i)
+        ;
+
+    if (i < 0)
+        /* unreachable unless the loop counter is abstracted by unknown value */
+        *(int *) 0 = 0;
+
+    return 0;
+}
@@ -0,0 +1,26 @@
+static void use(int i)
+{
+    (void) i;
+}
+
+int main()
+{
+    int c;
+    int i;
+
+    if (c == 1)
+        i = 100;
+    else if (c == 2)
+        i = 200;
+    else if (c == 3)
+        i = 300;
+    else if (c == 4)
+        i = 400;
+    else
+        i = 500;
+
+    /* five heaps meet here, the escalated three-way join leaves only one */
+    use(i);
+
+    return 0;
+}